@@ -0,0 +1,210 @@
+#include "adaptive_ranking.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+#include "constants.h"
+#include "helpers.h"
+
+namespace
+{
+
+// Rating deviation of an item without votes, and the number of items and neighbours searched per matchup
+constexpr double kInitialDeviation = 2.0;
+constexpr size_t kCandidateItems = 8;
+constexpr size_t kCandidateNeighbours = 4;
+
+auto pairKey(Index const a, Index const b) noexcept -> uint64_t {
+	return (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+}
+auto attenuation(double const variance) noexcept -> double {
+	// Glicko's g(), which reduces the impact of an opponent with an uncertain rating
+	return 1.0 / std::sqrt(1.0 + 3.0 * variance / (std::numbers::pi * std::numbers::pi));
+}
+auto winProbability(double const rating_difference, double const scale) noexcept -> double {
+	return 1.0 / (1.0 + std::exp(-scale * rating_difference));
+}
+
+} // namespace
+
+auto AdaptiveRanking::create(uint32_t const number_of_items, double const target_rating_deviation) -> std::optional<AdaptiveRanking> {
+	if (number_of_items < 2 || !isValidRatingDeviation(target_rating_deviation)) {
+		return std::nullopt;
+	}
+	AdaptiveRanking adaptive_ranking{};
+	adaptive_ranking.number_of_items_ = number_of_items;
+	adaptive_ranking.target_variance_ = target_rating_deviation * target_rating_deviation;
+	adaptive_ranking.reset();
+	adaptive_ranking.selectNextPair();
+	return adaptive_ranking;
+}
+void AdaptiveRanking::vote(Vote const& vote) {
+	voted_pairs_.insert(pairKey(vote.a_idx, vote.b_idx));
+	if (vote.winner == Option::A) {
+		update(vote.a_idx, vote.b_idx);
+	}
+	else {
+		update(vote.b_idx, vote.a_idx);
+	}
+	selectNextPair();
+}
+auto AdaptiveRanking::undoVote() -> bool {
+	if (steps_.empty()) {
+		return false;
+	}
+	Step const step = steps_.back();
+	steps_.pop_back();
+	voted_pairs_.erase(pairKey(step.winner, step.loser));
+	setRating(step.winner, step.winner_rating, step.winner_variance);
+	setRating(step.loser, step.loser_rating, step.loser_variance);
+	selectNextPair();
+	return true;
+}
+void AdaptiveRanking::replay(VoteLog const& votes) {
+	reset();
+	steps_.reserve(votes.size());
+	for (Vote const vote : votes) {
+		voted_pairs_.insert(pairKey(vote.a_idx, vote.b_idx));
+		if (vote.winner == Option::A) {
+			update(vote.a_idx, vote.b_idx);
+		}
+		else {
+			update(vote.b_idx, vote.a_idx);
+		}
+	}
+	selectNextPair();
+}
+auto AdaptiveRanking::isFinished() const noexcept -> bool {
+	return is_finished_;
+}
+auto AdaptiveRanking::currentIndexPair() const noexcept -> IndexPair {
+	return current_index_pair_;
+}
+auto AdaptiveRanking::rankedOrder() const -> std::vector<Index> {
+	auto const order = order_.toVector();
+	return { order.rbegin(), order.rend() };
+}
+auto AdaptiveRanking::estimatedNumberOfVotes(uint32_t const number_of_items, double const target_rating_deviation) noexcept -> uint32_t {
+	// Each vote between evenly rated items adds at most 1/4 to the precision of both their ratings
+	if (!isValidRatingDeviation(target_rating_deviation) || target_rating_deviation >= kInitialDeviation) {
+		return 0;
+	}
+	double const votes_per_item = 4.0 * (1.0 / (target_rating_deviation * target_rating_deviation) - 1.0 / (kInitialDeviation * kInitialDeviation));
+	double const estimate = std::ceil(votes_per_item * number_of_items / 2.0);
+	return static_cast<uint32_t>(std::min(estimate, static_cast<double>(sumOfFirstIntegers(number_of_items - 1ull))));
+}
+auto AdaptiveRanking::isValidRatingDeviation(double const rating_deviation) noexcept -> bool {
+	return std::isfinite(rating_deviation) && rating_deviation > 0.0;
+}
+void AdaptiveRanking::reset() {
+	ratings_.assign(number_of_items_, 0.0);
+	variances_.assign(number_of_items_, kInitialDeviation * kInitialDeviation);
+	order_.clear();
+	uncertainty_order_.clear();
+	for (Index index = 0; index < number_of_items_; index++) {
+		order_.insert(index, index);
+		uncertainty_order_.emplace(variances_[index], index);
+	}
+	voted_pairs_.clear();
+	steps_.clear();
+	current_index_pair_ = {};
+	is_finished_ = false;
+}
+void AdaptiveRanking::update(Index const winner, Index const loser) {
+	steps_.push_back({ winner, loser, ratings_[winner], variances_[winner], ratings_[loser], variances_[loser] });
+
+	double const rating_difference = ratings_[winner] - ratings_[loser];
+	auto const updated = [&](Index const index, Index const opponent, double const score, double const difference) {
+		double const g = attenuation(variances_[opponent]);
+		double const expected = winProbability(difference, g);
+		double const variance = 1.0 / (1.0 / variances_[index] + g * g * expected * (1.0 - expected));
+		return std::make_pair(ratings_[index] + variance * g * (score - expected), variance);
+	};
+	auto const [winner_rating, winner_variance] = updated(winner, loser, 1.0, rating_difference);
+	auto const [loser_rating, loser_variance] = updated(loser, winner, 0.0, -rating_difference);
+	setRating(winner, winner_rating, winner_variance);
+	setRating(loser, loser_rating, loser_variance);
+}
+void AdaptiveRanking::setRating(Index const index, double const rating, double const variance) {
+	// Both orders are keyed on the rating, so the item is taken out of them while it changes
+	order_.erase(static_cast<uint32_t>(orderPosition(index)));
+	auto node = uncertainty_order_.extract({ variances_[index], index });
+	ratings_[index] = rating;
+	variances_[index] = variance;
+	order_.insert(static_cast<uint32_t>(orderPosition(index)), index);
+	node.value().first = variance;
+	uncertainty_order_.insert(std::move(node));
+}
+void AdaptiveRanking::selectNextPair() {
+	current_index_pair_ = {};
+	is_finished_ = true;
+	if (voted_pairs_.size() >= sumOfFirstIntegers(number_of_items_ - 1ull)) {
+		return;
+	}
+	if (uncertainty_order_.begin()->first <= target_variance_) {
+		return;
+	}
+	is_finished_ = false;
+
+	// Pair each of the most uncertain items with its closest rated neighbours it hasn't been matched
+	// against yet. If none of them have any left, keep going through the remaining items.
+	double best_gain = -1.0;
+	size_t number_of_candidates = 0;
+	for (auto const& [variance, candidate] : uncertainty_order_) {
+		if (number_of_candidates == kCandidateItems && best_gain >= 0.0) {
+			break;
+		}
+		number_of_candidates++;
+		size_t const position = orderPosition(candidate);
+		size_t neighbours = 0;
+		for (size_t distance = 1; neighbours < 2 * kCandidateNeighbours && (distance <= position || position + distance < order_.size()); distance++) {
+			for (size_t const neighbour_position : { position - distance, position + distance }) {
+				// Wraps around for positions before the first, which are then out of range
+				if (neighbour_position >= order_.size()) {
+					continue;
+				}
+				Index const neighbour = order_.at(static_cast<uint32_t>(neighbour_position));
+				if (hasVoted(candidate, neighbour)) {
+					continue;
+				}
+				neighbours++;
+				double const gain = informationGain(candidate, neighbour);
+				if (gain > best_gain) {
+					best_gain = gain;
+					current_index_pair_ = { candidate, neighbour };
+				}
+			}
+		}
+	}
+}
+auto AdaptiveRanking::orderPosition(Index const index) const noexcept -> size_t {
+	// Binary search for the first item not rated below the given one
+	uint32_t start = 0;
+	uint32_t end = order_.size();
+	while (start < end) {
+		uint32_t const mid = start + (end - start) / 2;
+		if (isRatedBelow(order_.at(mid), index)) {
+			start = mid + 1;
+		}
+		else {
+			end = mid;
+		}
+	}
+	return start;
+}
+auto AdaptiveRanking::MoreUncertain::operator()(std::pair<double, Index> const& a, std::pair<double, Index> const& b) const noexcept -> bool {
+	return a.first != b.first ? a.first > b.first : a.second < b.second;
+}
+auto AdaptiveRanking::isRatedBelow(Index const a, Index const b) const noexcept -> bool {
+	return ratings_[a] != ratings_[b] ? ratings_[a] < ratings_[b] : a < b;
+}
+auto AdaptiveRanking::informationGain(Index const a, Index const b) const noexcept -> double {
+	// The outcome is most informative when it's least predictable, and the ratings least certain
+	double const variance = variances_[a] + variances_[b];
+	double const expected = winProbability(ratings_[a] - ratings_[b], attenuation(variance));
+	return expected * (1.0 - expected) * variance;
+}
+auto AdaptiveRanking::hasVoted(Index const a, Index const b) const -> bool {
+	return voted_pairs_.contains(pairKey(a, b));
+}
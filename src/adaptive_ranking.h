@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <set>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "constants.h"
+#include "index_pair.h"
+#include "order_statistic_tree.h"
+#include "vote.h"
+#include "vote_log.h"
+
+// Ranks items by estimating a strength rating for each of them, and picks each next matchup to be
+// the one expected to tell the most about the ratings, until every rating is certain enough.
+//
+// Each rating is a normal distribution on the Bradley-Terry (logistic) scale, updated after each
+// vote with the Glicko approximation. The next matchup pairs the items with the most uncertain
+// ratings with their closest rated neighbours, which they're least predictable against.
+// Loading replays the votes, while undoing restores the ratings the latest vote changed.
+//
+// The ranking finishes once every rating deviation is at most the target one, which must be positive.
+class AdaptiveRanking final {
+public:
+	static auto create(uint32_t const number_of_items, double const target_rating_deviation = kDefaultAdaptiveRatingDeviation) -> std::optional<AdaptiveRanking>;
+
+	void vote(Vote const& vote);
+	auto undoVote() -> bool;
+	void replay(VoteLog const& votes);
+
+	auto isFinished() const noexcept -> bool;
+	auto currentIndexPair() const noexcept -> IndexPair;
+
+	// Item indices from the highest to the lowest rated
+	auto rankedOrder() const -> std::vector<Index>;
+
+	static auto estimatedNumberOfVotes(uint32_t const number_of_items, double const target_rating_deviation = kDefaultAdaptiveRatingDeviation) noexcept -> uint32_t;
+	static auto isValidRatingDeviation(double const rating_deviation) noexcept -> bool;
+
+private:
+	// Ratings of the items of a vote before it, to restore when undoing it
+	struct Step {
+		Index winner{};
+		Index loser{};
+		double winner_rating{};
+		double winner_variance{};
+		double loser_rating{};
+		double loser_variance{};
+	};
+	// Most uncertain first. Ties are broken by index, to keep the selection deterministic.
+	struct MoreUncertain {
+		auto operator()(std::pair<double, Index> const& a, std::pair<double, Index> const& b) const noexcept -> bool;
+	};
+
+	void reset();
+	void update(Index const winner, Index const loser);
+	void setRating(Index const index, double const rating, double const variance);
+	void selectNextPair();
+	auto orderPosition(Index const index) const noexcept -> size_t;
+	auto isRatedBelow(Index const a, Index const b) const noexcept -> bool;
+	auto informationGain(Index const a, Index const b) const noexcept -> double;
+	auto hasVoted(Index const a, Index const b) const -> bool;
+
+	uint32_t number_of_items_{ 0 };
+	double target_variance_{ kDefaultAdaptiveRatingDeviation * kDefaultAdaptiveRatingDeviation };
+	std::vector<double> ratings_{};
+	std::vector<double> variances_{};
+	// Items from the lowest to the highest rated
+	OrderStatisticTree order_{};
+	// Variance and index of each item
+	std::set<std::pair<double, Index>, MoreUncertain> uncertainty_order_{};
+	std::unordered_set<uint64_t> voted_pairs_{};
+	std::vector<Step> steps_{};
+	IndexPair current_index_pair_{};
+	bool is_finished_{ false };
+};
@@ -0,0 +1,231 @@
+#include "batch_commands.h"
+
+#include <array>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <string_view>
+
+#include "adaptive_ranking.h"
+#include "constants.h"
+#include "functions.h"
+#include "helpers.h"
+#include "mapped_file.h"
+#include "print.h"
+#include "score_helpers.h"
+#include "voting_format.h"
+#include "voting_round.h"
+
+namespace
+{
+
+using Arguments = std::vector<std::string>;
+
+constexpr std::string_view kUsage =
+	"Usage:\n"
+	"  pairwise-ranking\n"
+	"  pairwise-ranking new <items file> <format> <voting round file> [seed] [rating deviation]\n"
+	"  pairwise-ranking vote <voting round file> [votes file]\n"
+	"  pairwise-ranking scores <voting round file> [scores file]\n"
+	"  pairwise-ranking ranking <voting round file> [ranking file]\n"
+	"  pairwise-ranking combine <combined scores file> <scores file> <scores file> [scores files...]\n"
+	"  pairwise-ranking convert <voting round file> <converted voting round file>\n"
+	"Without a command, the interactive menus are started.\n"
+	"Formats are full, reduced, ranked, merge and adaptive. Adaptive rounds finish once every rating\n"
+	"deviation is at most the given one, 0.5 by default.\n"
+	"Votes are read from stdin without a votes file, or when it's '-'. Each 'a' or 'b' votes for\n"
+	"that option, each 'u' undoes a vote, and whitespace is ignored.\n"
+	"Scores and rankings are printed without a file to save them to.";
+
+auto toExitCode(bool const success) -> int {
+	return static_cast<int>(success ? ExitCode::Success : ExitCode::Failure);
+}
+auto isScoreBased(VotingFormat const format) -> bool {
+	return format == VotingFormat::Full || format == VotingFormat::Reduced;
+}
+auto loadVotingRound(std::string const& file_name) -> std::optional<VotingRound> {
+	auto voting_round = VotingRound::load(file_name);
+	if (!voting_round.has_value()) {
+		printError("Could not load voting round from '" + file_name + "'");
+	}
+	return voting_round;
+}
+auto readVotes(std::string const& file_name) -> std::optional<std::string> {
+	if (file_name == "-") {
+		return std::string(std::istreambuf_iterator<char>(std::cin), std::istreambuf_iterator<char>());
+	}
+	std::ifstream file(file_name, std::ios::binary);
+	if (!file.is_open()) {
+		printError("Could not open '" + file_name + "'");
+		return std::nullopt;
+	}
+	return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+auto applyVotes(VotingRound& voting_round, std::string_view const votes) -> bool {
+	for (size_t i = 0; i < votes.size(); i++) {
+		auto const ch = static_cast<unsigned char>(votes[i]);
+		if (std::isspace(ch)) {
+			continue;
+		}
+		switch (std::tolower(ch)) {
+		case 'a':
+		case 'b':
+			if (!voting_round.vote(std::tolower(ch) == 'a' ? Option::A : Option::B)) {
+				printError("Can't vote at position " + std::to_string(i) + ". Voting round is completed");
+				return false;
+			}
+			break;
+		case 'u':
+			if (!voting_round.undoVote()) {
+				printError("Can't undo at position " + std::to_string(i) + ". No votes to undo");
+				return false;
+			}
+			break;
+		default:
+			printError("Invalid vote '" + std::string(1, votes[i]) + "' at position " + std::to_string(i));
+			return false;
+		}
+	}
+	return true;
+}
+
+/* -------------- Commands -------------- */
+auto newCommand(Arguments const& arguments) -> int {
+	auto const file = MappedFile::open(arguments[1]);
+	if (!file.has_value() || file.value().lines().size() < 2) {
+		printError("Too few items in '" + arguments[1] + "'. At least two expected.");
+		return toExitCode(false);
+	}
+	VotingFormat const format = stringToVotingFormat(arguments[2]);
+	if (format == VotingFormat::Invalid) {
+		printError("Invalid voting format '" + arguments[2] + "'");
+		return static_cast<int>(ExitCode::InvalidArguments);
+	}
+	std::optional<uint32_t> seed{ 0 };
+	if (arguments.size() > 4) {
+		seed = parseNumber(arguments[4]);
+		if (!seed.has_value()) {
+			return static_cast<int>(ExitCode::InvalidArguments);
+		}
+	}
+	std::optional<double> rating_deviation{ kDefaultAdaptiveRatingDeviation };
+	if (arguments.size() > 5) {
+		rating_deviation = parseDecimal(arguments[5]);
+		if (!rating_deviation.has_value() || !AdaptiveRanking::isValidRatingDeviation(rating_deviation.value())) {
+			printError("Invalid rating deviation '" + arguments[5] + "'. A positive number expected.");
+			return static_cast<int>(ExitCode::InvalidArguments);
+		}
+		if (format != VotingFormat::Adaptive) {
+			printError("Only adaptive voting rounds have a rating deviation");
+			return static_cast<int>(ExitCode::InvalidArguments);
+		}
+	}
+
+	auto voting_round = VotingRound::create(Items(file.value().lines().begin(), file.value().lines().end()), format, seed.value(), rating_deviation.value());
+	if (!voting_round.has_value()) {
+		printError("Could not generate voting round");
+		return toExitCode(false);
+	}
+	voting_round.value().shuffle();
+	return toExitCode(voting_round.value().save(arguments[3]));
+}
+auto voteCommand(Arguments const& arguments) -> int {
+	auto voting_round = loadVotingRound(arguments[1]);
+	if (!voting_round.has_value()) {
+		return toExitCode(false);
+	}
+	auto const votes = readVotes(arguments.size() > 2 ? arguments[2] : "-");
+	if (!votes.has_value()) {
+		return toExitCode(false);
+	}
+
+	// The voting round is only saved if every vote applies, so a failed stream can be fixed and rerun
+	if (!applyVotes(voting_round.value(), votes.value())) {
+		return toExitCode(false);
+	}
+	return toExitCode(voting_round.value().save(arguments[1]));
+}
+auto scoresCommand(Arguments const& arguments) -> int {
+	auto const voting_round = loadVotingRound(arguments[1]);
+	if (!voting_round.has_value()) {
+		return toExitCode(false);
+	}
+	if (!isScoreBased(voting_round.value().format())) {
+		printError("Scores are only kept by score-based voting rounds. Use 'ranking' instead");
+		return toExitCode(false);
+	}
+	if (arguments.size() > 2) {
+		return toExitCode(saveScores(voting_round.value().scores(), arguments[2]));
+	}
+	for (auto const& line : generateScoreFileData(sortScores(voting_round.value().scores()))) {
+		print(line);
+	}
+	return toExitCode(true);
+}
+auto rankingCommand(Arguments const& arguments) -> int {
+	auto const voting_round = loadVotingRound(arguments[1]);
+	if (!voting_round.has_value()) {
+		return toExitCode(false);
+	}
+	if (isScoreBased(voting_round.value().format())) {
+		printError("Rankings are only kept by rank-based voting rounds. Use 'scores' instead");
+		return toExitCode(false);
+	}
+	if (arguments.size() > 2) {
+		return toExitCode(saveFile(arguments[2], { createRanking(voting_round.value()) }));
+	}
+	print(createRanking(voting_round.value()), false);
+	return toExitCode(true);
+}
+auto combineCommand(Arguments const& arguments) -> int {
+	return toExitCode(combine(Arguments(arguments.begin() + 2, arguments.end()), arguments[1]));
+}
+auto convertCommand(Arguments const& arguments) -> int {
+	return toExitCode(convertVotingRoundFile(arguments[1], arguments[2]));
+}
+
+struct BatchCommand {
+	std::string_view name{};
+	size_t min_arguments{};		// Including the command name
+	size_t max_arguments{};
+	int (*run)(Arguments const&) {};
+};
+constexpr size_t kUnlimitedArguments = std::numeric_limits<size_t>::max();
+constexpr std::array<BatchCommand, 6> kBatchCommands{ {
+	{ "new", 4, 6, newCommand },
+	{ "vote", 2, 3, voteCommand },
+	{ "scores", 2, 3, scoresCommand },
+	{ "ranking", 2, 3, rankingCommand },
+	{ "combine", 4, kUnlimitedArguments, combineCommand },
+	{ "convert", 3, 3, convertCommand },
+} };
+
+} // namespace
+
+auto runBatchCommand(std::vector<std::string> const& arguments) -> int {
+	if (arguments.empty()) {
+		print(std::string{ kUsage });
+		return static_cast<int>(ExitCode::InvalidArguments);
+	}
+	if (arguments.front() == "help" || arguments.front() == "--help" || arguments.front() == "-h") {
+		print(std::string{ kUsage });
+		return static_cast<int>(ExitCode::Success);
+	}
+	for (auto const& command : kBatchCommands) {
+		if (arguments.front() != command.name) {
+			continue;
+		}
+		if (arguments.size() < command.min_arguments || arguments.size() > command.max_arguments) {
+			printError("Wrong number of arguments for '" + arguments.front() + "'");
+			print(std::string{ kUsage });
+			return static_cast<int>(ExitCode::InvalidArguments);
+		}
+		return command.run(arguments);
+	}
+	printError("Unknown command '" + arguments.front() + "'");
+	print(std::string{ kUsage });
+	return static_cast<int>(ExitCode::InvalidArguments);
+}
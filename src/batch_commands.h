@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+enum class ExitCode : int {
+	Success = 0,
+	Failure = 1,		// The command was valid, but couldn't be carried out
+	InvalidArguments = 2,
+};
+
+// Runs one command given on the command line, without menus or keyboard input, for scripted use.
+// The arguments exclude the executable name. Returns the process exit code.
+//   new <items file> <format> <voting round file> [seed]
+//   vote <voting round file> [votes file]
+//   scores <voting round file> [scores file]
+//   ranking <voting round file> [ranking file]
+//   combine <combined scores file> <scores file> <scores file> [scores files...]
+//   convert <voting round file> <converted voting round file>
+// Votes are read from stdin when no votes file is given, or when it's '-'. Scores and rankings
+// are printed when no file is given.
+auto runBatchCommand(std::vector<std::string> const& arguments) -> int;
@@ -0,0 +1,138 @@
+#include "benchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#include "print.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+
+std::atomic<uint64_t> g_allocations{ 0 };
+
+auto jsonString(std::string const& str) -> std::string {
+	std::string json = "\"";
+	for (char const c : str) {
+		if (c == '"' || c == '\\') {
+			json += '\\';
+		}
+		json += c;
+	}
+	return json + '"';
+}
+auto jsonNumber(double const number) -> std::string {
+	char buffer[32]{};
+	auto const end = std::to_chars(buffer, buffer + sizeof(buffer), number, std::chars_format::fixed, 1).ptr;
+	return std::string(buffer, end);
+}
+
+} // namespace
+
+/* -------------- Allocation counting -------------- */
+// Replaces the global allocation functions of the benchmark executables. The array and nothrow
+// versions forward to these by default.
+auto operator new(std::size_t const size) -> void* {
+	g_allocations.fetch_add(1, std::memory_order_relaxed);
+	if (void* const ptr = std::malloc(size == 0 ? 1 : size)) {
+		return ptr;
+	}
+	throw std::bad_alloc{};
+}
+void operator delete(void* const ptr) noexcept {
+	std::free(ptr);
+}
+void operator delete(void* const ptr, std::size_t) noexcept {
+	std::free(ptr);
+}
+
+/* -------------- Benchmark results -------------- */
+void report(BenchmarkResult const& result) {
+	double const operations = static_cast<double>(std::max<uint64_t>(result.operations, 1));
+	std::string json = "{\"benchmark\":" + jsonString(result.name);
+	for (auto const& [key, value] : result.parameters) {
+		json += "," + jsonString(key) + ":" + jsonString(value);
+	}
+	json += ",\"operations\":" + std::to_string(result.operations);
+	json += ",\"ns_per_op\":" + jsonNumber(static_cast<double>(result.elapsed.count()) / operations);
+	json += ",\"allocations_per_op\":" + jsonNumber(static_cast<double>(result.allocations) / operations);
+	if (result.median.has_value()) {
+		json += ",\"median_ns\":" + std::to_string(result.median.value().count());
+	}
+
+	auto const operation_time = result.median.value_or(result.elapsed / std::max<uint64_t>(result.operations, 1));
+	double const seconds = std::chrono::duration<double>(operation_time).count();
+	if (result.operations > 0 && seconds > 0.0) {
+		if (result.items_per_operation > 0) {
+			json += ",\"items_per_s\":" + jsonNumber(static_cast<double>(result.items_per_operation) / seconds);
+		}
+		if (result.bytes_per_operation > 0) {
+			json += ",\"mb_per_s\":" + jsonNumber(static_cast<double>(result.bytes_per_operation) / seconds / 1'000'000.0);
+		}
+	}
+	json += ",\"peak_rss_bytes\":" + std::to_string(peakResidentSetSize()) + "}";
+
+	// Written directly, since benchmarks capture everything printed by the code they measure
+	std::cout << json << std::endl;
+}
+
+/* -------------- Measuring -------------- */
+auto allocationCount() noexcept -> uint64_t {
+	return g_allocations.load(std::memory_order_relaxed);
+}
+auto medianTime(std::vector<std::chrono::nanoseconds> times) -> std::optional<std::chrono::nanoseconds> {
+	if (times.empty()) {
+		return std::nullopt;
+	}
+	auto const middle = times.begin() + times.size() / 2;
+	std::nth_element(times.begin(), middle, times.end());
+	return *middle;
+}
+auto peakResidentSetSize() -> uint64_t {
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters{};
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+		return 0;
+	}
+	return static_cast<uint64_t>(counters.PeakWorkingSetSize);
+#else
+	rusage usage{};
+	if (getrusage(RUSAGE_SELF, &usage) != 0) {
+		return 0;
+	}
+#ifdef __APPLE__
+	return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+	return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+/* -------------- Command line arguments -------------- */
+auto argumentValue(std::vector<std::string> const& arguments, std::string const& name, uint64_t const default_value) -> uint64_t {
+	std::string const prefix = "--" + name + "=";
+	for (auto const& argument : arguments) {
+		if (argument.rfind(prefix, 0) != 0) {
+			continue;
+		}
+		uint64_t value = 0;
+		auto const [end, error] = std::from_chars(argument.data() + prefix.size(), argument.data() + argument.size(), value);
+		if (error != std::errc{} || end != argument.data() + argument.size()) {
+			printError("Invalid value in '" + argument + "'");
+			return default_value;
+		}
+		return value;
+	}
+	return default_value;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* -------------- Benchmark results -------------- */
+// Values describing what a result measured, reported in this order
+using BenchmarkParameters = std::vector<std::pair<std::string, std::string>>;
+
+struct BenchmarkResult {
+	std::string name{};
+	BenchmarkParameters parameters{};
+	uint64_t operations{ 0 };
+	std::chrono::nanoseconds elapsed{ 0 };
+	uint64_t allocations{ 0 };
+	std::optional<std::chrono::nanoseconds> median{};	// Of the repetitions, if they were timed separately
+	uint64_t items_per_operation{ 0 };	// For throughput, if known
+	uint64_t bytes_per_operation{ 0 };
+};
+
+// Writes the result to stdout as one JSON object per line, with the time and allocations per
+// operation and the peak resident set size of the process so far, which only covers the result if
+// it was measured in a process of its own. Throughput in items and MB per
+// second is added when the items or bytes per operation are known, based on the median time if
+// there is one. It's written even while a PrintCapture collects what the measured code prints.
+void report(BenchmarkResult const& result);
+
+/* -------------- Measuring -------------- */
+// Number of allocations made through the global operator new, which the benchmarks replace
+auto allocationCount() noexcept -> uint64_t;
+auto peakResidentSetSize() -> uint64_t;
+auto medianTime(std::vector<std::chrono::nanoseconds> times) -> std::optional<std::chrono::nanoseconds>;
+
+// Runs the operation until it has run the maximum number of times, the time budget is spent, or
+// it returns false to tell that there was nothing left to do. It runs at least once unless it
+// returns false right away. The elapsed time includes reading the clock after each operation.
+template<typename Operation>
+auto measure(std::string name, BenchmarkParameters parameters, uint64_t const max_operations,
+	std::chrono::nanoseconds const budget, Operation&& operation) -> BenchmarkResult {
+	BenchmarkResult result{ std::move(name), std::move(parameters) };
+	uint64_t const first_allocation = allocationCount();
+	auto const start = std::chrono::steady_clock::now();
+	auto now = start;
+	while (result.operations < max_operations && (result.operations == 0 || now - start < budget)) {
+		if (!operation()) {
+			break;
+		}
+		now = std::chrono::steady_clock::now();
+		result.operations++;
+	}
+	result.elapsed = now - start;
+	result.allocations = allocationCount() - first_allocation;
+	return result;
+}
+
+// Runs the operation a number of times without measuring it, to warm up caches and the allocator,
+// and then times each repetition separately. Repetitions are only counted if the operation
+// returns true.
+template<typename Operation>
+auto measureRepetitions(std::string name, BenchmarkParameters parameters, uint64_t const warm_ups,
+	uint64_t const repetitions, Operation&& operation) -> BenchmarkResult {
+	for (uint64_t i = 0; i < warm_ups; i++) {
+		operation();
+	}
+
+	BenchmarkResult result{ std::move(name), std::move(parameters) };
+	std::vector<std::chrono::nanoseconds> times{};
+	times.reserve(repetitions);
+	uint64_t const first_allocation = allocationCount();
+	for (uint64_t i = 0; i < repetitions; i++) {
+		auto const start = std::chrono::steady_clock::now();
+		if (!operation()) {
+			break;
+		}
+		times.push_back(std::chrono::steady_clock::now() - start);
+		result.elapsed += times.back();
+		result.operations++;
+	}
+	result.allocations = allocationCount() - first_allocation;
+
+	result.median = medianTime(std::move(times));
+	return result;
+}
+
+/* -------------- Command line arguments -------------- */
+// Value of "--name=value" among the arguments, or the default value if it isn't given
+auto argumentValue(std::vector<std::string> const& arguments, std::string const& name, uint64_t const default_value) -> uint64_t;
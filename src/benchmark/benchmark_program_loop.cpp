@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "print.h"
+#include "program_loop.h"
+
+extern std::queue<char> g_keys;
+extern std::queue<std::string> g_lines;
+
+namespace
+{
+
+constexpr auto kItemsFile = "benchmark_program_loop_items.tmp";
+constexpr auto kVotingRoundFile = "benchmark_program_loop_round.tmp";
+constexpr auto kCombinedScoresFile = "benchmark_program_loop_combined.tmp";
+
+struct Options {
+	uint64_t number_of_items{};
+	uint64_t number_of_votes{};
+	uint64_t number_of_score_files{};
+	uint64_t undo_interval{};
+	uint64_t print_interval{};
+	uint64_t save_interval{};
+	uint64_t sessions{};
+};
+
+// Timings of every run of one program state
+struct StateTimings {
+	std::vector<std::chrono::nanoseconds> times{};
+	std::chrono::nanoseconds elapsed{ 0 };
+	uint64_t allocations{ 0 };
+};
+
+auto scoresFile(uint64_t const file_number) -> std::string {
+	return "benchmark_program_loop_scores_" + std::to_string(file_number) + ".tmp";
+}
+void createItemsFile(uint64_t const number_of_items) {
+	std::ofstream file(kItemsFile);
+	for (uint64_t i = 0; i < number_of_items; i++) {
+		file << "item" << i + 1 << "\n";
+	}
+}
+void removeFiles(Options const& options) {
+	std::filesystem::remove(kItemsFile);
+	std::filesystem::remove(kVotingRoundFile);
+	std::filesystem::remove(kCombinedScoresFile);
+	for (uint64_t i = 0; i < options.number_of_score_files; i++) {
+		std::filesystem::remove(scoresFile(i));
+	}
+}
+
+void queueSave(uint64_t const file_number) {
+	g_keys.push('s');
+	g_lines.push(kVotingRoundFile);
+	g_lines.push(scoresFile(file_number));
+}
+// Queues the input of a session as a user would give it. Every state is left the way its input
+// expects, since the mocked input ends the program if it runs out.
+void queueSession(Options const& options) {
+	// Create a full voting round
+	g_keys.push('n');
+	g_lines.push(kItemsFile);
+	g_keys.push('f');
+
+	// Vote, with regular undos, printouts and saves. Votes beyond the end of the round are refused.
+	for (uint64_t vote = 1; vote <= options.number_of_votes; vote++) {
+		g_keys.push(vote % 3 == 0 ? 'b' : 'a');
+		if (options.undo_interval > 0 && vote % options.undo_interval == 0) {
+			g_keys.push('u');
+		}
+		if (options.print_interval > 0 && vote % options.print_interval == 0) {
+			g_keys.push('p');
+		}
+		if (options.save_interval > 0 && vote % options.save_interval == 0) {
+			queueSave((vote / options.save_interval) % options.number_of_score_files);
+		}
+	}
+
+	// Save every score file, so all of them can be combined, and quit the saved round
+	for (uint64_t i = 0; i < options.number_of_score_files; i++) {
+		queueSave(i);
+	}
+	g_keys.push('q');
+
+	// Load the round, change it, and quit without saving
+	g_keys.push('l');
+	g_lines.push(kVotingRoundFile);
+	g_keys.push('p');
+	g_keys.push('u');
+	g_keys.push('a');
+	g_keys.push('q');
+	g_keys.push('n');
+
+	// Combine the score files, print and save the result
+	std::string file_names{};
+	for (uint64_t i = 0; i < options.number_of_score_files; i++) {
+		file_names += scoresFile(i) + " ";
+	}
+	g_keys.push('c');
+	g_lines.push(file_names);
+	g_keys.push('p');
+	g_keys.push('s');
+	g_lines.push(kCombinedScoresFile);
+
+	g_keys.push('q');
+}
+
+} // namespace
+
+// Runs scripted sessions through the program loop with mocked keyboard input, and reports the
+// time spent in each program state. A session creates a full voting round of --items items, votes
+// --votes times while undoing, printing scores and saving at the given intervals, saves
+// --score-files score files, loads the round again and combines the score files. What's printed is
+// put together but discarded.
+int main(int argc, char* argv[]) {
+	std::vector<std::string> const arguments(argv + 1, argv + argc);
+	Options const options{
+		std::max<uint64_t>(argumentValue(arguments, "items", 100), 2),
+		std::max<uint64_t>(argumentValue(arguments, "votes", 4'000), 1),
+		std::max<uint64_t>(argumentValue(arguments, "score-files", 4), 2),
+		argumentValue(arguments, "undo-interval", 10),
+		argumentValue(arguments, "print-interval", 500),
+		argumentValue(arguments, "save-interval", 1'000),
+		std::max<uint64_t>(argumentValue(arguments, "sessions", 3), 1) };
+	BenchmarkParameters const parameters{
+		{ "items", std::to_string(options.number_of_items) },
+		{ "votes", std::to_string(options.number_of_votes) },
+		{ "score_files", std::to_string(options.number_of_score_files) } };
+
+	createItemsFile(options.number_of_items);
+
+	std::map<std::string, StateTimings, std::less<>> state_timings{};
+	BenchmarkResult session_result{ "session", parameters };
+	{
+		PrintDiscard const discard{};
+		for (uint64_t session = 0; session < options.sessions; session++) {
+			queueSession(options);
+
+			// Whatever is allocated between two calls belongs to the state that just ran
+			uint64_t previous_allocations = allocationCount();
+			auto const state_timer = [&](std::string_view const state, std::chrono::nanoseconds const elapsed) {
+				uint64_t const allocations = allocationCount() - previous_allocations;
+				auto it = state_timings.find(state);
+				if (it == state_timings.end()) {
+					it = state_timings.emplace(std::string{ state }, StateTimings{}).first;
+				}
+				it->second.times.push_back(elapsed);
+				it->second.elapsed += elapsed;
+				it->second.allocations += allocations;
+				previous_allocations = allocationCount();
+			};
+
+			auto const first_allocation = allocationCount();
+			auto const start = std::chrono::steady_clock::now();
+			programLoop(state_timer);
+			session_result.elapsed += std::chrono::steady_clock::now() - start;
+			session_result.allocations += allocationCount() - first_allocation;
+			session_result.operations++;
+		}
+	}
+	removeFiles(options);
+
+	for (auto& [state, timings] : state_timings) {
+		BenchmarkResult result{ "state", parameters };
+		result.parameters.emplace_back("state", state);
+		result.operations = timings.times.size();
+		result.elapsed = timings.elapsed;
+		result.allocations = timings.allocations;
+		result.median = medianTime(std::move(timings.times));
+		report(result);
+	}
+	report(session_result);
+	return 0;
+}
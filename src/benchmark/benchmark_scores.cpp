@@ -0,0 +1,169 @@
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "calculate_scores.h"
+#include "print.h"
+#include "score_helpers.h"
+#include "vote_log.h"
+
+namespace
+{
+
+constexpr uint32_t kSeed = 12345;
+
+struct Options {
+	uint64_t number_of_items{};
+	uint64_t number_of_votes{};
+	uint64_t number_of_files{};
+	uint64_t name_length{};
+	uint64_t warm_ups{};
+	uint64_t repetitions{};
+};
+
+// Item names are padded to the name length, but are kept unique if the length is too short
+auto generateItems(Options const& options) -> Items {
+	Items items{};
+	items.reserve(options.number_of_items);
+	for (size_t i = 0; i < options.number_of_items; i++) {
+		Item item = "item" + std::to_string(i + 1);
+		if (item.size() < options.name_length) {
+			item.resize(options.name_length, '_');
+		}
+		items.push_back(std::move(item));
+	}
+	return items;
+}
+// Random matchups, where the lower indexed item wins three times out of four, so the strengths
+// have an order to find
+auto generateVotes(Options const& options) -> VoteLog {
+	std::default_random_engine engine(kSeed);
+	std::uniform_int_distribution<Index> item_distribution(0, static_cast<Index>(options.number_of_items - 1));
+	std::bernoulli_distribution upset_distribution(0.25);
+
+	VoteLog votes{};
+	votes.reserve(options.number_of_votes);
+	while (votes.size() < options.number_of_votes) {
+		Index const a_idx = item_distribution(engine);
+		Index const b_idx = item_distribution(engine);
+		if (a_idx == b_idx) {
+			continue;
+		}
+		bool const a_is_favorite = a_idx < b_idx;
+		bool const upset = upset_distribution(engine);
+		votes.append({ a_idx, b_idx, a_is_favorite != upset ? Option::A : Option::B });
+	}
+	return votes;
+}
+// Each file gets an equal share of the votes, as if they came from separate voting rounds
+auto generateScoreSets(Items const& items, VoteLog const& votes, size_t const number_of_files) -> std::vector<Scores> {
+	std::vector<Scores> score_sets{};
+	size_t const votes_per_file = votes.size() / number_of_files;
+	for (size_t i = 0; i < number_of_files; i++) {
+		size_t const first = i * votes_per_file;
+		size_t const last = (i + 1 == number_of_files ? votes.size() : first + votes_per_file);
+		VoteLog file_votes{};
+		file_votes.reserve(last - first);
+		for (size_t j = first; j < last; j++) {
+			file_votes.append(votes[j]);
+		}
+		score_sets.push_back(calculateScores(items, file_votes));
+	}
+	return score_sets;
+}
+auto numberOfScores(std::vector<Scores> const& score_sets) -> size_t {
+	size_t number_of_scores = 0;
+	for (auto const& scores : score_sets) {
+		number_of_scores += scores.size();
+	}
+	return number_of_scores;
+}
+// As if the lines were read from a file, with one newline each
+auto numberOfBytes(std::vector<std::string> const& lines) -> size_t {
+	size_t number_of_bytes = 0;
+	for (auto const& line : lines) {
+		number_of_bytes += line.size() + 1;
+	}
+	return number_of_bytes;
+}
+
+// The index columns and the winner bits
+auto numberOfBytes(VoteLog const& votes) -> size_t {
+	return (votes.aIndices().size() + votes.bIndices().size()) * sizeof(Index) + votes.winnerBits().size() * sizeof(uint64_t);
+}
+
+auto withThroughput(BenchmarkResult result, size_t const items_per_operation, size_t const bytes_per_operation) -> BenchmarkResult {
+	result.items_per_operation = items_per_operation;
+	result.bytes_per_operation = bytes_per_operation;
+	return result;
+}
+
+} // namespace
+
+// Reports the throughput of each step in the score pipeline, from calculating the scores of votes
+// to combining score files and presenting the result. The data is generated from the options
+// --items, --votes, --files and --name-length, and each step is run --warm-ups times before
+// it's measured --repetitions times.
+int main(int argc, char* argv[]) {
+	std::vector<std::string> const arguments(argv + 1, argv + argc);
+	Options const options{
+		std::max<uint64_t>(argumentValue(arguments, "items", 10'000), 2),
+		argumentValue(arguments, "votes", 100'000),
+		std::max<uint64_t>(argumentValue(arguments, "files", 4), 1),
+		argumentValue(arguments, "name-length", 16),
+		argumentValue(arguments, "warm-ups", 3),
+		argumentValue(arguments, "repetitions", 15) };
+	BenchmarkParameters const parameters{
+		{ "items", std::to_string(options.number_of_items) },
+		{ "votes", std::to_string(options.number_of_votes) },
+		{ "files", std::to_string(options.number_of_files) },
+		{ "name_length", std::to_string(options.name_length) } };
+
+	// Anything the score functions print would interleave with the results
+	PrintCapture const capture{};
+
+	auto const items = generateItems(options);
+	auto const votes = generateVotes(options);
+	auto const score_sets = generateScoreSets(items, votes, options.number_of_files);
+	auto const score_file_lines = generateScoreFileData(sortScores(score_sets.front()));
+	auto const combined_scores = combineScores(score_sets);
+	auto const sorted_scores = sortScores(combined_scores);
+
+	// Results are kept outside the measured operations, so they aren't optimized away
+	Scores scores{};
+	std::string table{};
+	std::vector<std::string> lines{};
+	WinLossCounts counts{};
+
+	report(withThroughput(measureRepetitions("count_wins_and_losses", parameters, options.warm_ups, options.repetitions, [&]() {
+		counts = countWinsAndLosses(votes, items.size());
+		return true;
+		}), votes.size(), numberOfBytes(votes)));
+	report(withThroughput(measureRepetitions("calculate_scores", parameters, options.warm_ups, options.repetitions, [&]() {
+		scores = calculateScores(items, votes);
+		return true;
+		}), votes.size(), 0));
+	report(withThroughput(measureRepetitions("parse_scores", parameters, options.warm_ups, options.repetitions, [&]() {
+		scores = parseScores(score_file_lines);
+		return true;
+		}), score_sets.front().size(), numberOfBytes(score_file_lines)));
+	report(withThroughput(measureRepetitions("combine_scores", parameters, options.warm_ups, options.repetitions, [&]() {
+		scores = combineScores(score_sets);
+		return true;
+		}), numberOfScores(score_sets), 0));
+	report(withThroughput(measureRepetitions("sort_scores", parameters, options.warm_ups, options.repetitions, [&]() {
+		scores = sortScores(combined_scores);
+		return true;
+		}), combined_scores.size(), 0));
+	report(withThroughput(measureRepetitions("create_score_table", parameters, options.warm_ups, options.repetitions, [&]() {
+		table = createScoreTable(sorted_scores);
+		return true;
+		}), sorted_scores.size(), createScoreTable(sorted_scores).size()));
+	report(withThroughput(measureRepetitions("generate_score_file_data", parameters, options.warm_ups, options.repetitions, [&]() {
+		lines = generateScoreFileData(sorted_scores);
+		return true;
+		}), sorted_scores.size(), numberOfBytes(generateScoreFileData(sorted_scores))));
+	return 0;
+}
@@ -0,0 +1,155 @@
+#include <array>
+#include <charconv>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "mapped_file.h"
+#include "print.h"
+#include "voting_format.h"
+#include "voting_round.h"
+
+namespace
+{
+
+constexpr auto kVotingRoundFile = "benchmark_voting_round.tmp";
+constexpr Seed kSeed = 12345;
+constexpr std::array kVotingFormats{
+	VotingFormat::Full,
+	VotingFormat::Reduced,
+	VotingFormat::Ranked,
+	VotingFormat::MergeInsertion,
+	VotingFormat::Adaptive,
+};
+
+struct Options {
+	uint64_t min_items{};
+	uint64_t max_items{};
+	uint64_t max_operations{};
+	std::chrono::nanoseconds budget{};
+};
+
+auto generateItems(size_t const number_of_items) -> Items {
+	Items items{};
+	items.reserve(number_of_items);
+	for (size_t i = 0; i < number_of_items; i++) {
+		items.emplace_back("item" + std::to_string(i + 1));
+	}
+	return items;
+}
+auto itemNumber(Item const& item) -> uint32_t {
+	uint32_t number = 0;
+	std::from_chars(item.data() + 4, item.data() + item.size(), number);
+	return number;
+}
+auto simulatedVote(VotingRound const& voting_round) -> Option {
+	// The voter prefers lower numbered items, so rank-based rounds see a consistent order
+	auto const matchup = voting_round.currentMatchup();
+	return itemNumber(matchup.value().item_a) < itemNumber(matchup.value().item_b) ? Option::A : Option::B;
+}
+auto withEncoding(BenchmarkParameters parameters, VotingRoundEncoding const encoding) -> BenchmarkParameters {
+	parameters.emplace_back("encoding", encoding == VotingRoundEncoding::Binary ? "binary" : "text");
+	return parameters;
+}
+
+// Measures each step of a voting round's lifecycle in the order a user goes through them, so each
+// step sees the state left by the previous one
+void benchmarkVotingRound(VotingFormat const format, size_t const number_of_items, Options const& options) {
+	BenchmarkParameters const parameters{
+		{ "format", votingFormatToString(format) },
+		{ "items", std::to_string(number_of_items) } };
+	auto const items = generateItems(number_of_items);
+
+	std::optional<VotingRound> voting_round{};
+	report(measure("create", parameters, options.max_operations, options.budget, [&]() {
+		voting_round = VotingRound::create(items, format, kSeed);
+		return voting_round.has_value() && voting_round.value().shuffle();
+		}));
+	if (!voting_round.has_value()) {
+		return;
+	}
+
+	report(measure("vote", parameters, options.max_operations, options.budget, [&]() {
+		if (!voting_round.value().hasRemainingVotes()) {
+			return false;
+		}
+		return voting_round.value().vote(simulatedVote(voting_round.value()));
+		}));
+	report(measure("current_voting_line", parameters, options.max_operations, options.budget, [&]() {
+		voting_round.value().currentVotingLine();
+		return true;
+		}));
+
+	for (auto const encoding : { VotingRoundEncoding::Text, VotingRoundEncoding::Binary }) {
+		voting_round.value().setEncoding(encoding);
+		report(measure("save", withEncoding(parameters, encoding), options.max_operations, options.budget, [&]() {
+			return voting_round.value().save(kVotingRoundFile);
+			}));
+		report(measure("load", withEncoding(parameters, encoding), options.max_operations, options.budget, [&]() {
+			auto const file = MappedFile::open(kVotingRoundFile);
+			return file.has_value() && VotingRound::create(file.value()).has_value();
+			}));
+		std::filesystem::remove(kVotingRoundFile);
+	}
+
+	report(measure("undo_vote", parameters, options.max_operations, options.budget, [&]() {
+		return voting_round.value().undoVote();
+		}));
+}
+
+// Command which measures one format and number of items in a process of its own
+auto childCommand(std::string const& executable, size_t const format_index, uint64_t const number_of_items, Options const& options) -> std::string {
+	std::string command = "\"" + executable + "\"" +
+		" --format-index=" + std::to_string(format_index) +
+		" --min-items=" + std::to_string(number_of_items) +
+		" --max-items=" + std::to_string(number_of_items) +
+		" --max-operations=" + std::to_string(options.max_operations) +
+		" --budget-ms=" + std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(options.budget).count());
+#ifdef _WIN32
+	// cmd.exe removes the outermost quotes of a command with more than one pair of them
+	command = "\"" + command + "\"";
+#endif
+	return command;
+}
+
+} // namespace
+
+// Reports how each step of a voting round scales with the number of items, for every voting format.
+// Item counts grow tenfold from --min-items to --max-items. Each step is measured for at most
+// --max-operations operations or --budget-ms milliseconds.
+//
+// Each format and number of items is measured in a process of its own, given by --format-index.
+// The peak resident set size can only be read for a whole process, so the largest round measured
+// before would otherwise be reported for every step after it.
+int main(int argc, char* argv[]) {
+	std::vector<std::string> const arguments(argv + 1, argv + argc);
+	Options const options{
+		argumentValue(arguments, "min-items", 10),
+		argumentValue(arguments, "max-items", 1'000'000),
+		argumentValue(arguments, "max-operations", 100'000),
+		std::chrono::milliseconds(argumentValue(arguments, "budget-ms", 200)) };
+	uint64_t const format_index = argumentValue(arguments, "format-index", kVotingFormats.size());
+
+	if (format_index < kVotingFormats.size()) {
+		// Anything the voting rounds print would interleave with the results
+		PrintCapture const capture{};
+		benchmarkVotingRound(kVotingFormats[format_index], std::max<uint64_t>(options.min_items, 2), options);
+		return 0;
+	}
+
+	for (uint64_t number_of_items = std::max<uint64_t>(options.min_items, 2); number_of_items <= options.max_items; number_of_items *= 10) {
+		for (size_t i = 0; i < kVotingFormats.size(); i++) {
+			// Results so far are written before the child writes its own
+			std::cout.flush();
+			if (std::system(childCommand(argv[0], i, number_of_items, options).c_str()) != 0) {
+				printError("Couldn't measure " + votingFormatToString(kVotingFormats[i]) + " voting with " + std::to_string(number_of_items) + " items");
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,71 @@
+#include "binary_io.h"
+
+void BinaryWriter::writeByte(uint8_t const byte) {
+	data_ += static_cast<char>(byte);
+}
+void BinaryWriter::writeVarint(uint64_t value) {
+	// Seven bits per byte, lowest bits first. The high bit marks that more bytes follow.
+	while (value >= 0x80) {
+		writeByte(static_cast<uint8_t>(value | 0x80));
+		value >>= 7;
+	}
+	writeByte(static_cast<uint8_t>(value));
+}
+void BinaryWriter::writeBytes(std::string_view const bytes) {
+	data_ += bytes;
+}
+void BinaryWriter::writeString(std::string_view const str) {
+	writeVarint(str.size());
+	writeBytes(str);
+}
+auto BinaryWriter::data() const noexcept -> std::string const& {
+	return data_;
+}
+
+BinaryReader::BinaryReader(std::string_view const data) noexcept : data_{ data } {
+}
+auto BinaryReader::readByte() noexcept -> std::optional<uint8_t> {
+	if (data_.empty()) {
+		return std::nullopt;
+	}
+	auto const byte = static_cast<uint8_t>(data_.front());
+	data_.remove_prefix(1);
+	return byte;
+}
+auto BinaryReader::readVarint() noexcept -> std::optional<uint64_t> {
+	uint64_t value = 0;
+	for (uint32_t shift = 0; shift < 64; shift += 7) {
+		auto const byte = readByte();
+		if (!byte.has_value()) {
+			return std::nullopt;
+		}
+		// The tenth byte only has room for the top bit of the value
+		if (shift == 63 && (byte.value() & 0x7E) != 0) {
+			return std::nullopt;
+		}
+		value |= static_cast<uint64_t>(byte.value() & 0x7F) << shift;
+		if ((byte.value() & 0x80) == 0) {
+			return value;
+		}
+	}
+	// More than 64 bits of data
+	return std::nullopt;
+}
+auto BinaryReader::readBytes(size_t const size) noexcept -> std::optional<std::string_view> {
+	if (size > data_.size()) {
+		return std::nullopt;
+	}
+	auto const bytes = data_.substr(0, size);
+	data_.remove_prefix(size);
+	return bytes;
+}
+auto BinaryReader::readString() noexcept -> std::optional<std::string_view> {
+	auto const size = readVarint();
+	if (!size.has_value()) {
+		return std::nullopt;
+	}
+	return readBytes(static_cast<size_t>(size.value()));
+}
+auto BinaryReader::atEnd() const noexcept -> bool {
+	return data_.empty();
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+// Appends bytes and LEB128 variable-length integers to a byte buffer
+class BinaryWriter final {
+public:
+	void writeByte(uint8_t const byte);
+	void writeVarint(uint64_t value);
+	void writeBytes(std::string_view const bytes);
+	void writeString(std::string_view const str);	// Length-prefixed
+
+	auto data() const noexcept -> std::string const&;
+private:
+	std::string data_{};
+};
+
+// Reads what BinaryWriter writes, failing on truncated or malformed data
+class BinaryReader final {
+public:
+	explicit BinaryReader(std::string_view const data) noexcept;
+
+	auto readByte() noexcept -> std::optional<uint8_t>;
+	auto readVarint() noexcept -> std::optional<uint64_t>;
+	auto readBytes(size_t const size) noexcept -> std::optional<std::string_view>;
+	auto readString() noexcept -> std::optional<std::string_view>;	// Length-prefixed
+
+	auto atEnd() const noexcept -> bool;
+private:
+	std::string_view data_{};
+};
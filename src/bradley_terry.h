@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "index_pair.h"
+#include "vote.h"
+#include "vote_log.h"
+
+// Wins and losses between each pair of items which have met in a matchup. Each item's row lists
+// only the opponents it has met, so the matrix grows with the number of votes rather than with the
+// square of the number of items.
+class WinMatrix final {
+public:
+	// Votes refer to items by index, and every index must be below the number of items
+	static auto create(size_t const number_of_items, VoteLog const& votes) -> WinMatrix;
+
+	auto numberOfItems() const noexcept -> size_t;
+	auto numberOfOpponents(Index const idx) const noexcept -> size_t;
+
+	// Bradley-Terry strength of each item, where an item beats another with the probability
+	// strength / (strength + other strength).
+	// Every item also gets one virtual win and one virtual loss against an item of strength 1,
+	// which keeps the strengths finite for items without wins or losses, and anchors them so that
+	// an item with as many wins as losses against average opponents has a strength of about 1.
+	auto fitStrengths() const -> std::vector<double>;
+
+private:
+	std::vector<size_t> row_starts_{};	// Row of item i is [row_starts_[i], row_starts_[i + 1])
+	std::vector<Index> opponents_{};
+	std::vector<double> wins_against_{};
+	std::vector<double> losses_against_{};
+};
@@ -1,52 +1,45 @@
 #include "calculate_scores.h"
 
-#include <algorithm>
+#include "bradley_terry.h"
+#include "profiler.h"
 
-namespace
-{
+auto calculateScores(Items const& items, VoteLog const& votes) -> Scores {
+	ScopedTimer const timer{ "calculateScores" };
+	addToCounter("votes_counted", votes.size());
 
-void incrementWinner(Scores& scores, Item const& item) {
-	auto it = std::find_if(scores.begin(), scores.end(), [&](Score const& score) {
-		return score.item == item;
-		});
-	if (it == scores.end()) {
-		Score score{};
-		score.item = item;
-		score.wins = 1;
-		scores.emplace_back(score);
-	}
-	else {
-		it->wins++;
-	}
-}
-void incrementLoser(Scores& scores, Item const& item) {
-	auto it = std::find_if(scores.begin(), scores.end(), [&](Score const& score) {
-		return score.item == item;
-		});
-	if (it == scores.end()) {
-		Score score{};
-		score.item = item;
-		score.losses = 1;
-		scores.emplace_back(score);
+	// Votes refer to items by index, so wins and losses are counted in flat arrays indexed the
+	// same way
+	auto const counts = countWinsAndLosses(votes, items.size());
+
+	// Items are listed in the order they first appear in the votes, winner before loser. The
+	// counts tell how many items appear, so the search stops once all of them are found.
+	size_t number_of_appearing_items = 0;
+	for (size_t idx = 0; idx < items.size(); idx++) {
+		if (counts.wins[idx] > 0 || counts.losses[idx] > 0) {
+			number_of_appearing_items++;
+		}
 	}
-	else {
-		it->losses++;
+	std::vector<Index> item_order{};
+	item_order.reserve(number_of_appearing_items);
+	std::vector<bool> has_appeared(items.size(), false);
+	auto const addIfFirstAppearance = [&](Index const idx) {
+		if (!has_appeared[idx]) {
+			has_appeared[idx] = true;
+			item_order.emplace_back(idx);
+		}
+	};
+	for (size_t i = 0; i < votes.size() && item_order.size() < number_of_appearing_items; i++) {
+		Vote const vote = votes[i];
+		addIfFirstAppearance(vote.winner == Option::A ? vote.a_idx : vote.b_idx);
+		addIfFirstAppearance(vote.winner == Option::A ? vote.b_idx : vote.a_idx);
 	}
-}
-
-} // namespace
 
-auto calculateScores(Items const& items, Votes const& votes) -> Scores {
+	// Resolve item names only once, when creating the scores
+	auto const strengths = WinMatrix::create(items.size(), votes).fitStrengths();
 	Scores scores{};
-	for (Vote const& vote : votes) {
-		if (vote.winner == Option::A) {
-			incrementWinner(scores, items[vote.a_idx]);
-			incrementLoser(scores, items[vote.b_idx]);
-		}
-		else {
-			incrementWinner(scores, items[vote.b_idx]);
-			incrementLoser(scores, items[vote.a_idx]);
-		}
+	scores.reserve(item_order.size());
+	for (Index const idx : item_order) {
+		scores.emplace_back(items[idx], counts.wins[idx], counts.losses[idx], strengths[idx]);
 	}
 	return scores;
 }
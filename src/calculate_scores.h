@@ -3,9 +3,9 @@
 #include <vector>
 
 #include "score.h"
-#include "vote.h"
+#include "vote_log.h"
 
 using Item = std::string;
 using Items = std::vector<Item>;
 
-auto calculateScores(Items const& items, Votes const& votes) -> Scores;
+auto calculateScores(Items const& items, VoteLog const& votes) -> Scores;
@@ -1,5 +1,16 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 constexpr uint32_t kMinimumItemsForPruning = 6;
+
+// Number of journaled votes and undos written before they're synced to disk
+constexpr uint32_t kJournalSyncInterval = 8;
+
+// Full voting rounds with more pairs than this compute each scheduled pair on demand
+constexpr size_t kMaxMaterializedIndexPairs = 1'000'000;
+
+// Adaptive voting rounds finish once every item's rating deviation is at most this, unless another
+// deviation is given when creating them. Lower values give a more confident ranking, at the cost of more votes.
+constexpr double kDefaultAdaptiveRatingDeviation = 0.5;
@@ -4,7 +4,6 @@
 #include <unordered_set>	// unordered_set
 #include <sstream>			// stringstream
 
-#include "calculate_scores.h"
 #include "helpers.h"
 #include "keyboard_input.h"
 #include "menus.h"
@@ -100,23 +99,43 @@ void printScores(std::optional<VotingRound> const& voting_round) {
 	{
 	case VotingFormat::Full:
 	case VotingFormat::Reduced:
-		print(createScoreTable(calculateScores(voting_round.value().items(), voting_round.value().votes())), false);
+		print(createScoreTable(voting_round.value().scores()), false);
 		break;
-	case VotingFormat::Ranked: {
-		auto const& items = voting_round.value().items();
-		std::string str{};
-		for (size_t i = 0; i < items.size(); i++) {
-			str += items[i];
-			if (i + 1 == voting_round.value().numberOfSortedItems()) {
-				str += " <-- sorted until here";
-			}
-			str += '\n';
-		}
-		print(str, false);
+	case VotingFormat::Ranked:
+	case VotingFormat::MergeInsertion:
+	case VotingFormat::Adaptive:
+		print(createRanking(voting_round.value()), false);
 		break;
-	}
 	case VotingFormat::Invalid:
 	default:
 		break;
 	}
 }
+
+auto createRanking(VotingRound const& voting_round) -> std::string {
+	auto const items = voting_round.items();
+	std::string str{};
+	for (size_t i = 0; i < items.size(); i++) {
+		str += items[i];
+		if (i + 1 == voting_round.numberOfSortedItems()) {
+			str += " <-- sorted until here";
+		}
+		str += '\n';
+	}
+	return str;
+}
+
+/* -------------- File conversion -------------- */
+auto convertVotingRoundFile(std::string const& input_file_name, std::string const& output_file_name) -> bool {
+	auto voting_round = VotingRound::load(input_file_name);
+	if (!voting_round.has_value()) {
+		printError("Could not load voting round from '" + input_file_name + "'");
+		return false;
+	}
+
+	// Save in the encoding the voting round wasn't loaded with
+	voting_round.value().setEncoding(voting_round.value().encoding() == VotingRoundEncoding::Text ?
+		VotingRoundEncoding::Binary :
+		VotingRoundEncoding::Text);
+	return voting_round.value().save(output_file_name);
+}
@@ -9,3 +9,8 @@ auto continueWithoutSaving(std::optional<VotingRound> const& voting_round, std::
 auto newRound(VotingFormat format, Items const& items) -> std::optional<VotingRound>;
 void loadRound(std::optional<VotingRound>& voting_round, std::vector<std::string> const& lines);
 void printScores(std::optional<VotingRound> const& voting_round);
+// Items of a rank-based voting round in ranked order, marking how far they're sorted
+auto createRanking(VotingRound const& voting_round) -> std::string;
+
+/* -------------- File conversion -------------- */
+auto convertVotingRoundFile(std::string const& input_file_name, std::string const& output_file_name) -> bool;
@@ -1,11 +1,15 @@
 #include "helpers.h"
 
-#include <sstream>
-#include <filesystem>
+#include <atomic>
+#include <charconv>
+#include <cmath>
 #include <fstream>
+#include <thread>
 
 #include "constants.h"
+#include "mapped_file.h"
 #include "print.h"
+#include "profiler.h"
 
 auto sumOfFirstIntegers(size_t n) noexcept -> size_t {
 	return (n * (n + 1)) / 2;
@@ -16,32 +20,50 @@ auto pruningAmount(uint32_t const number_of_items) noexcept -> uint32_t {
 	}
 	return 1 + (number_of_items - kMinimumItemsForPruning) / 2;
 }
-auto isNumber(std::string const& str) -> bool {
+auto isNumber(std::string_view const str) noexcept -> bool {
 	if (str.empty()) {
 		return false;
 	}
 	for (auto c : str) {
-		if (!std::isdigit(c)) {
+		if (c < '0' || c > '9') {
 			return false;
 		}
 	}
 	return true;
 }
-auto parseWords(std::string const& str) -> std::vector<std::string> {
-	std::stringstream stream(str);
+auto nextWord(std::string_view& str) noexcept -> std::string_view {
+	// Skips leading whitespace, then returns the next word and removes it from the string
+	constexpr std::string_view kWhitespace = " \t\n\v\f\r";
+	size_t const word_start = std::min(str.find_first_not_of(kWhitespace), str.size());
+	size_t const word_end = std::min(str.find_first_of(kWhitespace, word_start), str.size());
+	std::string_view const word = str.substr(word_start, word_end - word_start);
+	str.remove_prefix(word_end);
+	return word;
+}
+auto parseWords(std::string_view const str) -> std::vector<std::string> {
 	std::vector<std::string> words{};
-	std::string word{};
-	while (stream >> word) {
-		words.push_back(word);
+	std::string_view remaining = str;
+	for (auto word = nextWord(remaining); !word.empty(); word = nextWord(remaining)) {
+		words.emplace_back(word);
 	}
 	return words;
 }
-auto parseNumber(std::string const& str) -> std::optional<uint32_t> {
-	if (!isNumber(str)) {
-		printError("Unable to parse '" + str + "'. Not a number");
+auto parseNumber(std::string_view const str) -> std::optional<uint32_t> {
+	uint32_t number = 0;
+	if (!isNumber(str) || std::from_chars(str.data(), str.data() + str.size(), number).ec != std::errc{}) {
+		printError("Unable to parse '" + std::string{ str } + "'. Not a number");
+		return std::nullopt;
+	}
+	return number;
+}
+auto parseDecimal(std::string_view const str) -> std::optional<double> {
+	double number = 0.0;
+	auto const [end, ec] = std::from_chars(str.data(), str.data() + str.size(), number);
+	if (str.empty() || ec != std::errc{} || end != str.data() + str.size() || !std::isfinite(number)) {
+		printError("Unable to parse '" + std::string{ str } + "'. Not a decimal number");
 		return std::nullopt;
 	}
-	return static_cast<uint32_t>(std::stoul(str));
+	return number;
 }
 auto numberOfDigits(size_t n) noexcept -> size_t {
 	if (n == 0) {
@@ -50,21 +72,15 @@ auto numberOfDigits(size_t n) noexcept -> size_t {
 	return static_cast<size_t>(std::log10(n)) + 1;
 }
 auto loadFile(std::string const& file_name) -> std::vector<std::string> {
-	std::ifstream file(file_name);
-	if (!file.is_open()) {
-		printError("Could not open file \'" + file_name + "\' in " + std::filesystem::current_path().string());
+	ScopedTimer const timer{ "loadFile" };
+	auto const file = MappedFile::open(file_name);
+	if (!file.has_value()) {
 		return {};
 	}
-
-	std::vector<std::string> lines{};
-	std::string line;
-	while (std::getline(file, line)) {
-		lines.emplace_back(line);
-	}
-	file.close();
-	return lines;
+	return { file.value().lines().begin(), file.value().lines().end() };
 }
 auto saveFile(std::string const& file_name, std::vector<std::string> const& lines) -> bool {
+	ScopedTimer const timer{ "saveFile" };
 	if (lines.empty()) {
 		printError("No lines to save");
 		return false;
@@ -80,3 +96,38 @@ auto saveFile(std::string const& file_name, std::vector<std::string> const& line
 	file.close();
 	return true;
 }
+auto saveBinaryFile(std::string const& file_name, std::string_view const data) -> bool {
+	ScopedTimer const timer{ "saveBinaryFile" };
+	if (data.empty()) {
+		printError("No data to save");
+		return false;
+	}
+	std::ofstream file(file_name, std::ios::binary);
+	if (!file.is_open()) {
+		printError("Could not create file " + file_name);
+		return false;
+	}
+	file.write(data.data(), static_cast<std::streamsize>(data.size()));
+	file.close();
+	return true;
+}
+void runInParallel(size_t const number_of_tasks, std::function<void(size_t)> const& task) {
+	size_t const number_of_threads = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), number_of_tasks);
+
+	// Each thread picks the next task index until all tasks are taken
+	std::atomic<size_t> next_task{ 0 };
+	auto const worker = [&]() {
+		for (size_t i = next_task++; i < number_of_tasks; i = next_task++) {
+			task(i);
+		}
+	};
+
+	std::vector<std::thread> threads{};
+	threads.reserve(number_of_threads);
+	for (size_t i = 0; i < number_of_threads; i++) {
+		threads.emplace_back(worker);
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+}
@@ -1,19 +1,25 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
 auto sumOfFirstIntegers(size_t n) noexcept -> size_t;
 auto pruningAmount(uint32_t const number_of_items) noexcept -> uint32_t;
-auto isNumber(std::string const& str) -> bool;
-auto parseWords(std::string const& str) -> std::vector<std::string>;
-auto parseNumber(std::string const& str) -> std::optional<uint32_t>;
+auto isNumber(std::string_view const str) noexcept -> bool;
+auto nextWord(std::string_view& str) noexcept -> std::string_view;
+auto parseWords(std::string_view const str) -> std::vector<std::string>;
+auto parseNumber(std::string_view const str) -> std::optional<uint32_t>;
+auto parseDecimal(std::string_view const str) -> std::optional<double>;
 auto numberOfDigits(size_t n) noexcept -> size_t;
 auto saveFile(std::string const& file_name, std::vector<std::string> const& lines) -> bool;
+auto saveBinaryFile(std::string const& file_name, std::string_view const data) -> bool;
 auto loadFile(std::string const& file_name) -> std::vector<std::string>;
+void runInParallel(size_t const number_of_tasks, std::function<void(size_t)> const& task);
 
 template<typename T>
 constexpr auto to_underlying(T t) -> std::underlying_type_t<T> {
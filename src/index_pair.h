@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using Index = uint32_t;
+using IndexPair = std::pair<Index, Index>;
+struct IndexPairHash {
+	uint64_t operator()(IndexPair const& index_pair) const {
+		return (static_cast<uint64_t>(index_pair.first) << 32) + static_cast<uint64_t>(index_pair.second);
+	}
+};
+using IndexPairs = std::vector<IndexPair>;
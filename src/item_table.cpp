@@ -0,0 +1,38 @@
+#include "item_table.h"
+
+ItemTable::ItemTable(Items const& items) {
+	reserve(items.size());
+	for (auto const& item : items) {
+		intern(item);
+	}
+}
+auto ItemTable::intern(Item const& item) -> ItemId {
+	auto const [it, inserted] = ids_.try_emplace(item, static_cast<ItemId>(names_.size()));
+	if (inserted) {
+		names_.emplace_back(item);
+	}
+	return it->second;
+}
+auto ItemTable::find(Item const& item) const -> std::optional<ItemId> {
+	auto const it = ids_.find(item);
+	if (it == ids_.end()) {
+		return std::nullopt;
+	}
+	return it->second;
+}
+auto ItemTable::name(ItemId const id) const -> Item const& {
+	return names_[id];
+}
+auto ItemTable::names() const noexcept -> Items const& {
+	return names_;
+}
+auto ItemTable::size() const noexcept -> uint32_t {
+	return static_cast<uint32_t>(names_.size());
+}
+auto ItemTable::empty() const noexcept -> bool {
+	return names_.empty();
+}
+void ItemTable::reserve(size_t const number_of_items) {
+	names_.reserve(number_of_items);
+	ids_.reserve(number_of_items);
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using Item = std::string;
+using Items = std::vector<Item>;
+
+/* -------------- Item IDs -------------- */
+using ItemId = uint32_t;
+using ItemIds = std::vector<ItemId>;
+
+// Stores each unique item once and hands out dense IDs in order of first insertion,
+// so that IDs can be used to index flat arrays instead of comparing item names
+class ItemTable final {
+public:
+	ItemTable() = default;
+	explicit ItemTable(Items const& items);
+
+	auto intern(Item const& item) -> ItemId;
+	auto find(Item const& item) const -> std::optional<ItemId>;
+	auto name(ItemId const id) const -> Item const&;
+	auto names() const noexcept -> Items const&;
+	auto size() const noexcept -> uint32_t;
+	auto empty() const noexcept -> bool;
+	void reserve(size_t const number_of_items);
+
+private:
+	Items names_{};
+	std::unordered_map<Item, ItemId> ids_{};
+};
@@ -0,0 +1,171 @@
+#include "mapped_file.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "print.h"
+#include "profiler.h"
+
+auto MappedFile::open(std::string const& file_name) -> std::optional<MappedFile> {
+	ScopedTimer const timer{ "MappedFile::open" };
+	auto const openError = [&file_name]() {
+		printError("Could not open file \'" + file_name + "\' in " + std::filesystem::current_path().string());
+	};
+
+	MappedFile file{ nullptr, 0 };
+#ifdef _WIN32
+	HANDLE const file_handle = CreateFileA(file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file_handle == INVALID_HANDLE_VALUE) {
+		openError();
+		return std::nullopt;
+	}
+	file.file_handle_ = file_handle;
+
+	LARGE_INTEGER size{};
+	if (!GetFileSizeEx(file_handle, &size)) {
+		openError();
+		return std::nullopt;
+	}
+	file.size_ = static_cast<size_t>(size.QuadPart);
+
+	// Empty files can't be mapped, and have no lines anyway
+	if (file.size_ > 0) {
+		HANDLE const mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping_handle == nullptr) {
+			openError();
+			return std::nullopt;
+		}
+		file.mapping_handle_ = mapping_handle;
+
+		file.data_ = static_cast<char const*>(MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0));
+		if (file.data_ == nullptr) {
+			openError();
+			return std::nullopt;
+		}
+	}
+#else
+	int const descriptor = ::open(file_name.c_str(), O_RDONLY);
+	if (descriptor < 0) {
+		openError();
+		return std::nullopt;
+	}
+
+	struct stat file_status {};
+	if (fstat(descriptor, &file_status) != 0 || !S_ISREG(file_status.st_mode)) {
+		::close(descriptor);
+		openError();
+		return std::nullopt;
+	}
+	file.size_ = static_cast<size_t>(file_status.st_size);
+
+	// Empty files can't be mapped, and have no lines anyway
+	if (file.size_ > 0) {
+		void* const data = mmap(nullptr, file.size_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+		if (data == MAP_FAILED) {
+			::close(descriptor);
+			openError();
+			return std::nullopt;
+		}
+		file.data_ = static_cast<char const*>(data);
+	}
+
+	// The mapping stays valid after the descriptor is closed
+	::close(descriptor);
+#endif
+
+	file.indexLines();
+	addToCounter("bytes_mapped", file.size_);
+	return file;
+}
+MappedFile::MappedFile(char const* data, size_t size) noexcept
+	: data_{ data }
+	, size_{ size } {
+}
+MappedFile::MappedFile(MappedFile&& other) noexcept
+	: data_{ std::exchange(other.data_, nullptr) }
+	, size_{ std::exchange(other.size_, 0) }
+	, lines_{ std::move(other.lines_) }
+#ifdef _WIN32
+	, file_handle_{ std::exchange(other.file_handle_, nullptr) }
+	, mapping_handle_{ std::exchange(other.mapping_handle_, nullptr) }
+#endif
+{
+	other.lines_.clear();
+}
+auto MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile& {
+	if (this != &other) {
+		close();
+		data_ = std::exchange(other.data_, nullptr);
+		size_ = std::exchange(other.size_, 0);
+		lines_ = std::move(other.lines_);
+		other.lines_.clear();
+#ifdef _WIN32
+		file_handle_ = std::exchange(other.file_handle_, nullptr);
+		mapping_handle_ = std::exchange(other.mapping_handle_, nullptr);
+#endif
+	}
+	return *this;
+}
+MappedFile::~MappedFile() {
+	close();
+}
+auto MappedFile::lines() const noexcept -> Lines const& {
+	return lines_;
+}
+auto MappedFile::data() const noexcept -> std::string_view {
+	return { data_, size_ };
+}
+void MappedFile::indexLines() {
+	// Split lines the same way std::getline() does in text mode: a trailing newline
+	// doesn't start another line, and carriage returns before newlines are dropped
+	std::string_view const content = data();
+	lines_.reserve(static_cast<size_t>(std::count(content.begin(), content.end(), '\n')) + 1);
+
+	size_t line_start = 0;
+	while (line_start < content.size()) {
+		size_t line_end = content.find('\n', line_start);
+		if (line_end == std::string_view::npos) {
+			line_end = content.size();
+		}
+		std::string_view line = content.substr(line_start, line_end - line_start);
+		if (!line.empty() && line.back() == '\r') {
+			line.remove_suffix(1);
+		}
+		lines_.emplace_back(line);
+		line_start = line_end + 1;
+	}
+}
+void MappedFile::close() noexcept {
+	lines_.clear();
+#ifdef _WIN32
+	if (data_ != nullptr) {
+		UnmapViewOfFile(data_);
+	}
+	if (mapping_handle_ != nullptr) {
+		CloseHandle(mapping_handle_);
+	}
+	if (file_handle_ != nullptr) {
+		CloseHandle(file_handle_);
+	}
+	file_handle_ = nullptr;
+	mapping_handle_ = nullptr;
+#else
+	if (data_ != nullptr) {
+		munmap(const_cast<char*>(data_), size_);
+	}
+#endif
+	data_ = nullptr;
+	size_ = 0;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using Lines = std::vector<std::string_view>;
+
+// Read-only file mapped into memory, with an index of its lines.
+// Lines are views into the mapping, so they're only valid as long as the file is.
+class MappedFile final {
+public:
+	static auto open(std::string const& file_name) -> std::optional<MappedFile>;
+
+	MappedFile(MappedFile&& other) noexcept;
+	auto operator=(MappedFile&& other) noexcept -> MappedFile&;
+	MappedFile(MappedFile const&) = delete;
+	auto operator=(MappedFile const&) -> MappedFile& = delete;
+	~MappedFile();
+
+	auto lines() const noexcept -> Lines const&;
+	auto data() const noexcept -> std::string_view;
+
+private:
+	MappedFile(char const* data, size_t size) noexcept;
+	void indexLines();
+	void close() noexcept;
+
+	char const* data_{ nullptr };
+	size_t size_{ 0 };
+	Lines lines_{};
+#ifdef _WIN32
+	void* file_handle_{ nullptr };
+	void* mapping_handle_{ nullptr };
+#endif
+};
@@ -0,0 +1,73 @@
+#include "matchup_bitmap.h"
+
+#include <algorithm>
+
+namespace
+{
+
+// Bitmaps up to this size are used regardless of the number of matchups
+constexpr uint64_t kMinBitmapBytesLimit = 1 << 20;
+
+auto sortedMatchup(Index const a, Index const b) noexcept -> IndexPair {
+	return a < b ? IndexPair{ a, b } : IndexPair{ b, a };
+}
+auto toIndexPair(Vote const& vote) noexcept -> IndexPair {
+	return { vote.a_idx, vote.b_idx };
+}
+auto toIndexPair(IndexPair const& index_pair) noexcept -> IndexPair {
+	return index_pair;
+}
+
+template<typename Matchups>
+auto hasDuplicateMatchupsImpl(uint32_t const number_of_items, Matchups const& matchups) -> bool {
+	uint64_t const sorted_bytes = matchups.size() * sizeof(uint64_t);
+	if (MatchupBitmap::sizeInBytes(number_of_items) <= std::max(kMinBitmapBytesLimit, sorted_bytes)) {
+		MatchupBitmap bitmap{ number_of_items };
+		return !std::all_of(matchups.begin(), matchups.end(), [&bitmap](auto const& matchup) {
+			return bitmap.set(toIndexPair(matchup));
+			});
+	}
+
+	std::vector<uint64_t> bit_indices{};
+	bit_indices.reserve(matchups.size());
+	for (auto const& matchup : matchups) {
+		bit_indices.push_back(MatchupBitmap::bitIndex(toIndexPair(matchup)));
+	}
+	std::sort(bit_indices.begin(), bit_indices.end());
+	return std::adjacent_find(bit_indices.begin(), bit_indices.end()) != bit_indices.end();
+}
+
+} // namespace
+
+MatchupBitmap::MatchupBitmap(uint32_t const number_of_items)
+	: words_((sizeInBytes(number_of_items) + sizeof(uint64_t) - 1) / sizeof(uint64_t), 0) {
+}
+auto MatchupBitmap::set(IndexPair const& matchup) -> bool {
+	uint64_t const bit = bitIndex(matchup);
+	uint64_t const mask = 1ull << (bit % 64);
+	uint64_t& word = words_[bit / 64];
+	if ((word & mask) != 0) {
+		return false;
+	}
+	word |= mask;
+	return true;
+}
+auto MatchupBitmap::isSet(IndexPair const& matchup) const noexcept -> bool {
+	uint64_t const bit = bitIndex(matchup);
+	return (words_[bit / 64] & (1ull << (bit % 64))) != 0;
+}
+auto MatchupBitmap::bitIndex(IndexPair const& matchup) noexcept -> uint64_t {
+	auto const [low, high] = sortedMatchup(matchup.first, matchup.second);
+	return static_cast<uint64_t>(high) * (high - 1) / 2 + low;
+}
+auto MatchupBitmap::sizeInBytes(uint32_t const number_of_items) noexcept -> uint64_t {
+	uint64_t const number_of_matchups = static_cast<uint64_t>(number_of_items) * (number_of_items == 0 ? 0 : number_of_items - 1) / 2;
+	return (number_of_matchups + 7) / 8;
+}
+
+auto hasDuplicateMatchups(uint32_t const number_of_items, VoteLog const& votes) -> bool {
+	return hasDuplicateMatchupsImpl(number_of_items, votes);
+}
+auto hasDuplicateMatchups(uint32_t const number_of_items, IndexPairs const& index_pairs) -> bool {
+	return hasDuplicateMatchupsImpl(number_of_items, index_pairs);
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "index_pair.h"
+#include "vote.h"
+#include "vote_log.h"
+
+// One bit for each possible matchup between N items, where (a, b) and (b, a) are the same matchup.
+// Matchup (a, b) with a < b has bit b(b-1)/2 + a, so N(N-1)/2 bits cover every matchup and all
+// of an item's matchups against lower items are next to each other.
+class MatchupBitmap final {
+public:
+	explicit MatchupBitmap(uint32_t const number_of_items);
+
+	// Returns false if the matchup was already set
+	auto set(IndexPair const& matchup) -> bool;
+	auto isSet(IndexPair const& matchup) const noexcept -> bool;
+
+	static auto bitIndex(IndexPair const& matchup) noexcept -> uint64_t;
+	static auto sizeInBytes(uint32_t const number_of_items) noexcept -> uint64_t;
+
+private:
+	std::vector<uint64_t> words_{};
+};
+
+// Whether two matchups are between the same two items, in either order. Every index must be
+// smaller than the number of items, and no matchup may be against the same item.
+// A bitmap is used while it's no larger than a sorted copy of the matchups would be, or small
+// anyway. Otherwise, the sorted copy is checked for neighbouring duplicates.
+auto hasDuplicateMatchups(uint32_t const number_of_items, VoteLog const& votes) -> bool;
+auto hasDuplicateMatchups(uint32_t const number_of_items, IndexPairs const& index_pairs) -> bool;
@@ -0,0 +1,232 @@
+#include "merge_insertion.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace
+{
+
+// Jacobsthal numbers 1, 3, 5, 11, 21, 43, ..., which bound the groups of pending items inserted
+// together, so that each insertion searches a chain of at most 2^k - 1 items
+auto jacobsthalNumber(uint32_t const k) noexcept -> size_t {
+	size_t const power = size_t{ 1 } << (k + 1);
+	return (k % 2 == 0 ? power + 1 : power - 1) / 3;
+}
+
+} // namespace
+
+auto MergeInsertion::create(uint32_t const number_of_items) -> std::optional<MergeInsertion> {
+	if (number_of_items < 2) {
+		return std::nullopt;
+	}
+	MergeInsertion merge_insertion{};
+	merge_insertion.number_of_items_ = number_of_items;
+	merge_insertion.replay({});
+	return merge_insertion;
+}
+auto MergeInsertion::replay(VoteLog const& votes) -> bool {
+	levels_.assign(1, Level{});
+	levels_.front().order.resize(number_of_items_);
+	std::iota(levels_.front().order.begin(), levels_.front().order.end(), 0);
+	steps_.clear();
+	steps_.reserve(votes.size());
+	is_inserting_ = false;
+	is_sorted_ = false;
+	level_ = 0;
+	insertion_ = 0;
+	search_start_ = 0;
+	search_end_ = 0;
+	chain_positions_.assign(number_of_items_, 0);
+
+	for (Vote const vote : votes) {
+		if (isSorted()) {
+			return false;
+		}
+		auto const index_pair = currentIndexPair();
+		if (vote.a_idx != index_pair.first || vote.b_idx != index_pair.second) {
+			return false;
+		}
+		this->vote(vote.winner);
+	}
+	return true;
+}
+auto MergeInsertion::vote(Option const option) -> bool {
+	if (isSorted()) {
+		return false;
+	}
+	bool const first_is_before_second = (option == Option::A);
+
+	if (!is_inserting_) {
+		steps_.push_back(Step{});
+
+		// Pair up items, to sort the items ranked after their partner on the next level
+		Level& level = levels_.back();
+		size_t const pair = level.later_items.size();
+		Index const a = level.order[2 * pair];
+		Index const b = level.order[2 * pair + 1];
+		Index const earlier = (first_is_before_second ? a : b);
+		Index const later = (first_is_before_second ? b : a);
+		level.later_items.push_back(later);
+		level.earlier_partner[later] = earlier;
+		if (level.later_items.size() < level.order.size() / 2) {
+			return true;
+		}
+
+		if (level.later_items.size() > 1) {
+			Order next_order = level.later_items;
+			levels_.emplace_back();
+			levels_.back().order = std::move(next_order);
+			return true;
+		}
+
+		// A single later item is already sorted, so the deepest level can be inserted into
+		is_inserting_ = true;
+		buildChain(static_cast<uint32_t>(levels_.size() - 1));
+		startNextInsertion();
+		return true;
+	}
+
+	steps_.push_back(Step{ true, level_, insertion_, search_start_, search_end_ });
+
+	// Binary search among the items before the bound, like ranked voting does
+	Level& level = levels_[level_];
+	uint32_t const mid = (search_start_ + search_end_) / 2;
+	if (first_is_before_second) {
+		search_start_ = mid + 1;
+	}
+	else {
+		search_end_ = mid;
+	}
+	if (search_start_ < search_end_) {
+		return true;
+	}
+
+	level.chain.insert(level.chain.begin() + search_start_, level.pending[insertion_].index);
+	updateChainPositions(search_start_);
+	insertion_++;
+	startNextInsertion();
+	return true;
+}
+auto MergeInsertion::undoVote() -> bool {
+	if (steps_.empty()) {
+		return false;
+	}
+	Step const step = steps_.back();
+	steps_.pop_back();
+	is_sorted_ = false;
+
+	if (!step.is_insertion) {
+		// The vote might have finished the pairing, or paired up the last items of a level
+		is_inserting_ = false;
+		if (levels_.size() > 1 && levels_.back().later_items.empty()) {
+			levels_.pop_back();
+		}
+		Level& level = levels_.back();
+		level.earlier_partner.erase(level.later_items.back());
+		level.later_items.pop_back();
+		return true;
+	}
+
+	// Levels above the one the vote was cast on are rebuilt when they're reached again
+	if (step.level != level_ || step.insertion != insertion_) {
+		// The vote finished an insertion, so the inserted item is removed again
+		bool const is_other_level = (step.level != level_);
+		level_ = step.level;
+		Level& level = levels_[level_];
+		if (is_other_level) {
+			updateChainPositions(0);
+		}
+		uint32_t const position = chain_positions_[level.pending[step.insertion].index];
+		level.chain.erase(level.chain.begin() + position);
+		updateChainPositions(position);
+	}
+	insertion_ = step.insertion;
+	search_start_ = step.search_start;
+	search_end_ = step.search_end;
+	return true;
+}
+auto MergeInsertion::isSorted() const noexcept -> bool {
+	return is_sorted_;
+}
+auto MergeInsertion::currentIndexPair() const noexcept -> IndexPair {
+	if (isSorted()) {
+		return {};
+	}
+	if (!is_inserting_) {
+		Level const& level = levels_.back();
+		size_t const pair = level.later_items.size();
+		return { level.order[2 * pair], level.order[2 * pair + 1] };
+	}
+	Level const& level = levels_[level_];
+	return { level.chain[(search_start_ + search_end_) / 2], level.pending[insertion_].index };
+}
+auto MergeInsertion::sortedOrder() const noexcept -> std::vector<Index> const& {
+	return levels_.front().chain;
+}
+auto MergeInsertion::maximumNumberOfVotes(uint32_t const number_of_items) noexcept -> uint32_t {
+	// Sum of ceil(log2(3k / 4)) for k in [1, N]
+	uint32_t number_of_votes = 0;
+	for (uint32_t k = 1; k <= number_of_items; k++) {
+		number_of_votes += static_cast<uint32_t>(std::ceil(std::log2(3.0 * k / 4.0)));
+	}
+	return number_of_votes;
+}
+void MergeInsertion::buildChain(uint32_t const level_index) {
+	level_ = level_index;
+	insertion_ = 0;
+	Level& level = levels_[level_];
+
+	// The later items are sorted by the level below, unless this is the deepest level
+	Order const& sorted_later_items = (level_ + 1 < levels_.size() ? levels_[level_ + 1].chain : level.later_items);
+
+	// The partner of the first item is ranked before every item in the chain
+	level.chain.clear();
+	level.chain.reserve(level.order.size());
+	level.chain.push_back(level.earlier_partner[sorted_later_items.front()]);
+	level.chain.insert(level.chain.end(), sorted_later_items.begin(), sorted_later_items.end());
+	updateChainPositions(0);
+
+	// Remaining partners, each bounded by the item it was paired with, and the unpaired item last
+	std::vector<PendingItem> pending{};
+	pending.reserve(level.later_items.size());
+	for (size_t i = 1; i < sorted_later_items.size(); i++) {
+		Index const later = sorted_later_items[i];
+		pending.push_back({ level.earlier_partner[later], later });
+	}
+	if (level.order.size() % 2 == 1) {
+		pending.push_back({ level.order.back(), std::nullopt });
+	}
+
+	// Pending items are inserted in groups, each group in reverse order
+	level.pending.clear();
+	level.pending.reserve(pending.size());
+	size_t inserted = 0;
+	for (uint32_t k = 2; inserted < pending.size(); k++) {
+		size_t const group_end = std::min(jacobsthalNumber(k) - 1, pending.size());
+		for (size_t i = group_end; i > inserted; i--) {
+			level.pending.push_back(pending[i - 1]);
+		}
+		inserted = group_end;
+	}
+}
+void MergeInsertion::startNextInsertion() {
+	// A level without pending items is sorted as soon as its chain is built
+	while (insertion_ == levels_[level_].pending.size()) {
+		if (level_ == 0) {
+			is_sorted_ = true;
+			return;
+		}
+		buildChain(level_ - 1);
+	}
+	Level const& level = levels_[level_];
+	PendingItem const& item = level.pending[insertion_];
+	search_start_ = 0;
+	search_end_ = static_cast<uint32_t>(item.bound_index.has_value() ? chain_positions_[item.bound_index.value()] : level.chain.size());
+}
+void MergeInsertion::updateChainPositions(uint32_t const first_position) {
+	Order const& chain = levels_[level_].chain;
+	for (uint32_t position = first_position; position < chain.size(); position++) {
+		chain_positions_[chain[position]] = position;
+	}
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "index_pair.h"
+#include "vote.h"
+#include "vote_log.h"
+
+// Ford-Johnson merge-insertion sort of item positions, driven by votes. Option A means the first
+// index of a matchup is ranked before the second.
+//
+// The recursion of the algorithm is unrolled into levels. Items are first paired up level by level,
+// each level pairing the items ranked after their partner on the level above, until one item is
+// left. Pending items are then inserted into the chain of each level, from the deepest level up,
+// with binary searches advancing one vote at a time. Where each vote was cast is recorded, so it
+// can be undone without replaying the votes before it.
+class MergeInsertion final {
+public:
+	static auto create(uint32_t const number_of_items) -> std::optional<MergeInsertion>;
+
+	// Starts over and casts the given votes, such as when loading. Returns false if they don't
+	// match the comparisons the algorithm makes, or if there are votes left after the items are sorted.
+	auto replay(VoteLog const& votes) -> bool;
+	// Answers the current comparison. Returns false if the items are already sorted.
+	auto vote(Option const option) -> bool;
+	auto undoVote() -> bool;
+
+	auto isSorted() const noexcept -> bool;
+	auto currentIndexPair() const noexcept -> IndexPair;
+	// Only complete once the items are sorted
+	auto sortedOrder() const noexcept -> std::vector<Index> const&;
+
+	// Most comparisons merge-insertion needs to sort the given number of items
+	static auto maximumNumberOfVotes(uint32_t const number_of_items) noexcept -> uint32_t;
+
+private:
+	using Order = std::vector<Index>;
+
+	// Item to insert into a chain before the item it was paired with, or anywhere if unpaired
+	struct PendingItem {
+		Index index{};
+		std::optional<Index> bound_index{};
+	};
+	struct Level {
+		Order order{};
+		// Item ranked after its partner in each pair compared so far
+		Order later_items{};
+		std::unordered_map<Index, Index> earlier_partner{};
+
+		// Built once the level below is sorted. Pending items are kept in the order they're inserted.
+		Order chain{};
+		std::vector<PendingItem> pending{};
+	};
+	// State before a vote, to restore when undoing it
+	struct Step {
+		bool is_insertion{ false };
+		uint32_t level{ 0 };
+		uint32_t insertion{ 0 };
+		uint32_t search_start{ 0 };
+		uint32_t search_end{ 0 };
+	};
+
+	void buildChain(uint32_t const level_index);
+	void startNextInsertion();
+	void updateChainPositions(uint32_t const first_position);
+
+	uint32_t number_of_items_{ 0 };
+	std::vector<Level> levels_{};
+	std::vector<Step> steps_{};
+
+	// Insertion state. Levels are inserted into from the deepest one up.
+	bool is_inserting_{ false };
+	bool is_sorted_{ false };
+	uint32_t level_{ 0 };
+	uint32_t insertion_{ 0 };
+	uint32_t search_start_{ 0 };
+	uint32_t search_end_{ 0 };
+	// Position of each item in the chain of the current level, so bounds are found without searching
+	std::vector<uint32_t> chain_positions_{};
+};
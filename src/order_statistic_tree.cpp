@@ -0,0 +1,120 @@
+#include "order_statistic_tree.h"
+
+auto OrderStatisticTree::at(uint32_t const position) const noexcept -> Index {
+	NodeId node = root_;
+	uint32_t remaining = position;
+	while (node != kNoNode) {
+		uint32_t const left_size = subtreeSize(nodes_[node].left);
+		if (remaining < left_size) {
+			node = nodes_[node].left;
+		}
+		else if (remaining == left_size) {
+			return nodes_[node].value;
+		}
+		else {
+			remaining -= left_size + 1;
+			node = nodes_[node].right;
+		}
+	}
+	return {};
+}
+void OrderStatisticTree::insert(uint32_t const position, Index const value) {
+	NodeId const node = createNode(value);
+	auto const [left, right] = split(root_, position);
+	root_ = merge(merge(left, node), right);
+}
+auto OrderStatisticTree::erase(uint32_t const position) -> Index {
+	auto const [left, rest] = split(root_, position);
+	auto const [node, right] = split(rest, 1);
+	root_ = merge(left, right);
+	if (node == kNoNode) {
+		return {};
+	}
+	free_nodes_.push_back(node);
+	return nodes_[node].value;
+}
+void OrderStatisticTree::clear() noexcept {
+	nodes_.clear();
+	free_nodes_.clear();
+	root_ = kNoNode;
+}
+auto OrderStatisticTree::size() const noexcept -> uint32_t {
+	return subtreeSize(root_);
+}
+auto OrderStatisticTree::toVector() const -> std::vector<Index> {
+	std::vector<Index> values{};
+	values.reserve(size());
+
+	// In-order traversal with an explicit stack
+	std::vector<NodeId> stack{};
+	NodeId node = root_;
+	while (node != kNoNode || !stack.empty()) {
+		while (node != kNoNode) {
+			stack.push_back(node);
+			node = nodes_[node].left;
+		}
+		node = stack.back();
+		stack.pop_back();
+		values.push_back(nodes_[node].value);
+		node = nodes_[node].right;
+	}
+	return values;
+}
+auto OrderStatisticTree::createNode(Index const value) -> NodeId {
+	Node const new_node{ value, nextPriority(), 1, kNoNode, kNoNode };
+	if (!free_nodes_.empty()) {
+		NodeId const node = free_nodes_.back();
+		free_nodes_.pop_back();
+		nodes_[node] = new_node;
+		return node;
+	}
+	nodes_.push_back(new_node);
+	return static_cast<NodeId>(nodes_.size() - 1);
+}
+auto OrderStatisticTree::subtreeSize(NodeId const node) const noexcept -> uint32_t {
+	return node == kNoNode ? 0 : nodes_[node].size;
+}
+void OrderStatisticTree::updateSize(NodeId const node) noexcept {
+	nodes_[node].size = subtreeSize(nodes_[node].left) + subtreeSize(nodes_[node].right) + 1;
+}
+auto OrderStatisticTree::split(NodeId const node, uint32_t const count) noexcept -> std::pair<NodeId, NodeId> {
+	// Splits the subtree into its first count values and the remaining values
+	if (node == kNoNode) {
+		return { kNoNode, kNoNode };
+	}
+	uint32_t const left_size = subtreeSize(nodes_[node].left);
+	if (count <= left_size) {
+		auto const [left, right] = split(nodes_[node].left, count);
+		nodes_[node].left = right;
+		updateSize(node);
+		return { left, node };
+	}
+	auto const [left, right] = split(nodes_[node].right, count - left_size - 1);
+	nodes_[node].right = left;
+	updateSize(node);
+	return { node, right };
+}
+auto OrderStatisticTree::merge(NodeId const left, NodeId const right) noexcept -> NodeId {
+	// Every value in the left subtree is placed before every value in the right subtree
+	if (left == kNoNode) {
+		return right;
+	}
+	if (right == kNoNode) {
+		return left;
+	}
+	if (nodes_[left].priority > nodes_[right].priority) {
+		nodes_[left].right = merge(nodes_[left].right, right);
+		updateSize(left);
+		return left;
+	}
+	nodes_[right].left = merge(left, nodes_[right].left);
+	updateSize(right);
+	return right;
+}
+auto OrderStatisticTree::nextPriority() noexcept -> uint32_t {
+	// xorshift32, deterministic so that copies and replays build identical trees
+	random_state_ ^= random_state_ << 13;
+	random_state_ ^= random_state_ >> 17;
+	random_state_ ^= random_state_ << 5;
+	return random_state_;
+}
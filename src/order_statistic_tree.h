@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "index_pair.h"
+
+// Sequence of indices which can be looked up, inserted and erased at any position in O(log N).
+// Implemented as an implicit treap, where each node's position is given by the sizes of the subtrees
+// to its left, rather than by a stored key.
+class OrderStatisticTree final {
+public:
+	auto at(uint32_t const position) const noexcept -> Index;
+	void insert(uint32_t const position, Index const value);
+	auto erase(uint32_t const position) -> Index;
+	void clear() noexcept;
+	auto size() const noexcept -> uint32_t;
+	auto toVector() const -> std::vector<Index>;
+
+private:
+	using NodeId = uint32_t;
+	static constexpr NodeId kNoNode = std::numeric_limits<NodeId>::max();
+
+	struct Node {
+		Index value{};
+		uint32_t priority{};
+		uint32_t size{};
+		NodeId left{ kNoNode };
+		NodeId right{ kNoNode };
+	};
+
+	auto createNode(Index const value) -> NodeId;
+	auto subtreeSize(NodeId const node) const noexcept -> uint32_t;
+	void updateSize(NodeId const node) noexcept;
+	auto split(NodeId const node, uint32_t const count) noexcept -> std::pair<NodeId, NodeId>;
+	auto merge(NodeId const left, NodeId const right) noexcept -> NodeId;
+	auto nextPriority() noexcept -> uint32_t;
+
+	std::vector<Node> nodes_{};
+	std::vector<NodeId> free_nodes_{};
+	NodeId root_{ kNoNode };
+	uint32_t random_state_{ 0x9e3779b9 };
+};
@@ -0,0 +1,93 @@
+#include "pair_schedule.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "helpers.h"
+#include "print.h"
+
+namespace
+{
+
+auto mix(uint64_t x) noexcept -> uint64_t {
+	// splitmix64 finalizer
+	x ^= x >> 30;
+	x *= 0xbf58476d1ce4e5b9ull;
+	x ^= x >> 27;
+	x *= 0x94d049bb133111ebull;
+	x ^= x >> 31;
+	return x;
+}
+
+} // namespace
+
+auto PairSchedule::create(uint32_t const number_of_items) -> std::optional<PairSchedule> {
+	if (number_of_items < 2) {
+		printError("Number of items (" + std::to_string(number_of_items) + ") is less than two");
+		return std::nullopt;
+	}
+	return PairSchedule{ number_of_items };
+}
+PairSchedule::PairSchedule(uint32_t const number_of_items) noexcept :
+	number_of_items_{ number_of_items },
+	number_of_pairs_{ sumOfFirstIntegers(number_of_items - 1ull) } {
+	// The Feistel network permutes a domain of 2 * half_bits_ bits, which covers all pair ranks
+	while ((1ull << (2 * half_bits_)) < number_of_pairs_) {
+		half_bits_++;
+	}
+}
+void PairSchedule::shuffle(uint32_t const seed) noexcept {
+	uint64_t state = seed;
+	for (auto& round_key : round_keys_) {
+		state = mix(state + 0x9e3779b97f4a7c15ull);
+		round_key = state;
+	}
+	is_shuffled_ = true;
+}
+auto PairSchedule::indexPair(uint64_t const position) const noexcept -> IndexPair {
+	if (position >= number_of_pairs_) {
+		return {};
+	}
+	return unrank(is_shuffled_ ? permute(position) : position);
+}
+auto PairSchedule::size() const noexcept -> uint64_t {
+	return number_of_pairs_;
+}
+auto PairSchedule::permute(uint64_t const position) const noexcept -> uint64_t {
+	uint64_t const half_mask = (1ull << half_bits_) - 1;
+
+	// Cycle-walk until the permuted value lands within the pair ranks again. The domain is less
+	// than four times larger than the number of pairs, so only a few steps are expected.
+	uint64_t value = position;
+	do {
+		uint64_t left = value >> half_bits_;
+		uint64_t right = value & half_mask;
+		for (auto const round_key : round_keys_) {
+			uint64_t const next_right = left ^ (mix(right ^ round_key) & half_mask);
+			left = right;
+			right = next_right;
+		}
+		value = (left << half_bits_) | right;
+	} while (value >= number_of_pairs_);
+	return value;
+}
+auto PairSchedule::unrank(uint64_t const rank) const noexcept -> IndexPair {
+	// Pairs starting with item a begin at rank a(2N - a - 1) / 2. Solve for the largest such a,
+	// then correct any rounding error of the square root.
+	uint64_t const n = number_of_items_;
+	auto const first_rank = [n](uint64_t const a) noexcept {
+		return a * (2 * n - a - 1) / 2;
+	};
+	double const discriminant = static_cast<double>(2 * n - 1) * static_cast<double>(2 * n - 1) - 8.0 * static_cast<double>(rank);
+	uint64_t a = static_cast<uint64_t>((static_cast<double>(2 * n - 1) - std::sqrt(std::max(discriminant, 0.0))) / 2.0);
+	a = std::min(a, n - 2);
+	while (a > 0 && first_rank(a) > rank) {
+		a--;
+	}
+	while (a + 1 < n - 1 && first_rank(a + 1) <= rank) {
+		a++;
+	}
+	uint64_t const b = a + 1 + (rank - first_rank(a));
+	return { static_cast<Index>(a), static_cast<Index>(b) };
+}
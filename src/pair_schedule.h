@@ -0,0 +1,34 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+#include "index_pair.h"
+
+// Schedule of every pair of N items, where the pair at any position is computed on demand.
+// Positions are mapped through a seeded permutation of [0, N(N-1)/2), which is then unranked into
+// the pair at that rank in the order (0, 1), (0, 2), ..., (0, N-1), (1, 2), ..., (N-2, N-1).
+// Memory use and the cost of looking up a pair are independent of the number of items.
+class PairSchedule final {
+public:
+	static auto create(uint32_t const number_of_items) -> std::optional<PairSchedule>;
+
+	void shuffle(uint32_t const seed) noexcept;
+	auto indexPair(uint64_t const position) const noexcept -> IndexPair;
+	auto size() const noexcept -> uint64_t;
+
+private:
+	PairSchedule(uint32_t const number_of_items) noexcept;
+
+	auto permute(uint64_t const position) const noexcept -> uint64_t;
+	auto unrank(uint64_t const rank) const noexcept -> IndexPair;
+
+	static constexpr uint32_t kRounds = 4;
+
+	uint32_t number_of_items_{ 0 };
+	uint64_t number_of_pairs_{ 0 };
+	uint32_t half_bits_{ 0 };
+	bool is_shuffled_{ false };
+	std::array<uint64_t, kRounds> round_keys_{};
+};
@@ -1,11 +1,24 @@
 ﻿#include <clocale>
+#include <string>
+#include <vector>
 
+#include "batch_commands.h"
+#include "profiler.h"
 #include "program_loop.h"
 
-int main() {
+int main(int argc, char* argv[]) {
 	setlocale(LC_ALL, "sv-SE");
+	startProfilingFromEnvironment();
 
-	programLoop();
+	// Any arguments run a single batch command instead of the interactive menus
+	int exit_code = 0;
+	if (argc > 1) {
+		exit_code = runBatchCommand(std::vector<std::string>(argv + 1, argv + argc));
+	}
+	else {
+		programLoop();
+	}
 
-	return 0;
+	stopProfiling();
+	return exit_code;
 }
@@ -2,7 +2,25 @@
 
 #include <iostream>
 
+namespace
+{
+
+thread_local std::string* t_captured_output{ nullptr };
+thread_local std::string t_discarded_output{};	// Only its address is used, to tell that output is discarded
+
+} // namespace
+
 void print(std::string const& str, bool add_newline) {
+	if (t_captured_output == &t_discarded_output) {
+		return;
+	}
+	if (t_captured_output != nullptr) {
+		*t_captured_output += str;
+		if (add_newline) {
+			*t_captured_output += '\n';
+		}
+		return;
+	}
 	std::cout << str;
 	if (add_newline) {
 		std::cout << std::endl;
@@ -11,3 +29,20 @@ void print(std::string const& str, bool add_newline) {
 void printError(std::string const& err) {
 	print("Error: " + err);
 }
+
+PrintCapture::PrintCapture() : previous_output_{ t_captured_output } {
+	t_captured_output = &output_;
+}
+PrintCapture::~PrintCapture() {
+	t_captured_output = previous_output_;
+}
+auto PrintCapture::output() const noexcept -> std::string const& {
+	return output_;
+}
+
+PrintDiscard::PrintDiscard() : previous_output_{ t_captured_output } {
+	t_captured_output = &t_discarded_output;
+}
+PrintDiscard::~PrintDiscard() {
+	t_captured_output = previous_output_;
+}
@@ -4,3 +4,31 @@
 
 void print(std::string const& str, bool add_newline = true);
 void printError(std::string const& err);
+
+// Collects everything printed on the current thread while alive, instead of printing it.
+// Lets work running on other threads report its output in a deterministic order.
+class PrintCapture final {
+public:
+	PrintCapture();
+	~PrintCapture();
+	PrintCapture(PrintCapture const&) = delete;
+	auto operator=(PrintCapture const&) -> PrintCapture& = delete;
+
+	auto output() const noexcept -> std::string const&;
+private:
+	std::string output_{};
+	std::string* previous_output_{ nullptr };
+};
+
+// Discards everything printed on the current thread while alive. What's printed is still put
+// together by the caller, so benchmarks can measure it without the cost of the terminal.
+class PrintDiscard final {
+public:
+	PrintDiscard();
+	~PrintDiscard();
+	PrintDiscard(PrintDiscard const&) = delete;
+	auto operator=(PrintDiscard const&) -> PrintDiscard& = delete;
+
+private:
+	std::string* previous_output_{ nullptr };
+};
@@ -0,0 +1,200 @@
+#include "profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "print.h"
+
+namespace
+{
+
+struct TimerTotals {
+	uint64_t count{ 0 };
+	std::chrono::nanoseconds total{ 0 };
+	std::chrono::nanoseconds longest{ 0 };
+};
+struct TraceEvent {
+	char const* name{ nullptr };
+	uint32_t thread{ 0 };
+	std::chrono::nanoseconds start{ 0 };	// Since profiling started
+	std::optional<std::chrono::nanoseconds> duration{};	// Only for timers
+	uint64_t counter_value{ 0 };	// Only for counters, as their total so far
+};
+struct Profile {
+	std::string file_name{};
+	ProfileFormat format{ ProfileFormat::Summary };
+	std::chrono::steady_clock::time_point start{};
+	std::map<std::string_view, TimerTotals> timers{};
+	std::map<std::string_view, uint64_t> counters{};
+	std::vector<TraceEvent> events{};
+};
+
+std::atomic<bool> g_profiling{ false };
+std::mutex g_profile_mutex{};
+Profile g_profile{};
+std::atomic<uint32_t> g_number_of_threads{ 0 };
+thread_local uint32_t t_thread_number{ 0 };	// Numbered as threads first record something, from 1
+
+auto threadNumber() -> uint32_t {
+	if (t_thread_number == 0) {
+		t_thread_number = ++g_number_of_threads;
+	}
+	return t_thread_number;
+}
+
+auto environmentVariable(char const* name) -> std::string {
+#ifdef _WIN32
+	char* value = nullptr;
+	size_t size = 0;
+	if (_dupenv_s(&value, &size, name) != 0 || value == nullptr) {
+		return {};
+	}
+	std::string const str{ value };
+	std::free(value);
+	return str;
+#else
+	char const* const value = std::getenv(name);
+	return value == nullptr ? std::string{} : std::string{ value };
+#endif
+}
+
+auto formatNumber(double const number) -> std::string {
+	char buffer[32]{};
+	auto const end = std::to_chars(buffer, buffer + sizeof(buffer), number, std::chars_format::fixed, 3).ptr;
+	return std::string(buffer, end);
+}
+auto milliseconds(std::chrono::nanoseconds const duration) -> std::string {
+	return formatNumber(std::chrono::duration<double, std::milli>(duration).count());
+}
+auto microseconds(std::chrono::nanoseconds const duration) -> std::string {
+	return formatNumber(std::chrono::duration<double, std::micro>(duration).count());
+}
+
+void writeSummary(std::ofstream& file, Profile const& profile) {
+	file << "{\n\t\"timers\": {";
+	bool first = true;
+	for (auto const& [name, totals] : profile.timers) {
+		file << (first ? "\n" : ",\n") << "\t\t\"" << name << "\": { \"count\": " << totals.count
+			<< ", \"total_ms\": " << milliseconds(totals.total) << ", \"longest_ms\": " << milliseconds(totals.longest) << " }";
+		first = false;
+	}
+	file << "\n\t},\n\t\"counters\": {";
+	first = true;
+	for (auto const& [name, total] : profile.counters) {
+		file << (first ? "\n" : ",\n") << "\t\t\"" << name << "\": " << total;
+		first = false;
+	}
+	file << "\n\t}\n}\n";
+}
+void writeTrace(std::ofstream& file, Profile const& profile) {
+	file << "{\"traceEvents\":[";
+	bool first = true;
+	for (auto const& event : profile.events) {
+		file << (first ? "\n" : ",\n") << "{\"name\":\"" << event.name << "\",\"pid\":1,\"tid\":" << event.thread
+			<< ",\"ts\":" << microseconds(event.start);
+		if (event.duration.has_value()) {
+			file << ",\"ph\":\"X\",\"dur\":" << microseconds(event.duration.value()) << "}";
+		}
+		else {
+			file << ",\"ph\":\"C\",\"args\":{\"value\":" << event.counter_value << "}}";
+		}
+		first = false;
+	}
+	file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+} // namespace
+
+/* -------------- Profiling -------------- */
+void startProfiling(std::string const& file_name, ProfileFormat const format) {
+	std::lock_guard const lock{ g_profile_mutex };
+	g_profile = Profile{ file_name, format, std::chrono::steady_clock::now() };
+	g_profiling = true;
+}
+auto startProfilingFromEnvironment() -> bool {
+	std::string const file_name = environmentVariable(kProfileFileVariable);
+	if (file_name.empty()) {
+		return false;
+	}
+	std::string const format = environmentVariable(kProfileFormatVariable);
+	if (!format.empty() && format != "summary" && format != "trace") {
+		printError("Invalid profile format '" + format + "'. Writing a summary instead");
+	}
+	startProfiling(file_name, format == "trace" ? ProfileFormat::Trace : ProfileFormat::Summary);
+	return true;
+}
+auto isProfiling() noexcept -> bool {
+	return g_profiling.load(std::memory_order_relaxed);
+}
+auto stopProfiling() -> bool {
+	std::lock_guard const lock{ g_profile_mutex };
+	if (!g_profiling) {
+		return false;
+	}
+	g_profiling = false;
+
+	std::ofstream file(g_profile.file_name);
+	if (!file.is_open()) {
+		printError("Could not create profile " + g_profile.file_name);
+		return false;
+	}
+	if (g_profile.format == ProfileFormat::Trace) {
+		writeTrace(file, g_profile);
+	}
+	else {
+		writeSummary(file, g_profile);
+	}
+	g_profile = Profile{};
+	return file.good();
+}
+
+/* -------------- Timers and counters -------------- */
+ScopedTimer::ScopedTimer(char const* const name) noexcept {
+	if (isProfiling()) {
+		name_ = name;
+		start_ = std::chrono::steady_clock::now();
+	}
+}
+ScopedTimer::~ScopedTimer() {
+	if (name_ == nullptr) {
+		return;
+	}
+	auto const duration = std::chrono::steady_clock::now() - start_;
+	std::lock_guard const lock{ g_profile_mutex };
+	// Profiling may have stopped, or restarted, while this was timing
+	if (!g_profiling || start_ < g_profile.start) {
+		return;
+	}
+
+	if (g_profile.format == ProfileFormat::Trace) {
+		g_profile.events.push_back({ name_, threadNumber(), start_ - g_profile.start, duration });
+		return;
+	}
+	auto& totals = g_profile.timers[name_];
+	totals.count++;
+	totals.total += duration;
+	totals.longest = std::max(totals.longest, std::chrono::nanoseconds{ duration });
+}
+void addToCounter(char const* const name, uint64_t const amount) {
+	if (!isProfiling()) {
+		return;
+	}
+	auto const now = std::chrono::steady_clock::now();
+	std::lock_guard const lock{ g_profile_mutex };
+	if (!g_profiling) {
+		return;
+	}
+
+	uint64_t const total = (g_profile.counters[name] += amount);
+	if (g_profile.format == ProfileFormat::Trace) {
+		g_profile.events.push_back({ name, threadNumber(), now - g_profile.start, std::nullopt, total });
+	}
+}
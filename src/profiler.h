@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// The application profiles itself when this environment variable names a file to write the
+// profile to, once it exits
+constexpr auto kProfileFileVariable = "PAIRWISE_RANKING_PROFILE";
+// Either "summary" or "trace". Defaults to a summary.
+constexpr auto kProfileFormatVariable = "PAIRWISE_RANKING_PROFILE_FORMAT";
+
+enum class ProfileFormat {
+	Summary,	// Count, total and longest time per timer, and total per counter, as JSON
+	Trace,		// Every timer and counter update as Chrome trace events, viewable in chrome://tracing
+};
+
+/* -------------- Profiling -------------- */
+// Timers and counters are recorded from any thread until profiling stops. While not profiling,
+// they only check whether to record.
+void startProfiling(std::string const& file_name, ProfileFormat format);
+auto startProfilingFromEnvironment() -> bool;
+auto isProfiling() noexcept -> bool;
+// Writes the profile to its file. Returns false if nothing was profiled or it couldn't be written.
+auto stopProfiling() -> bool;
+
+/* -------------- Timers and counters -------------- */
+// Times the scope it's created in. Names must outlive the profile, so use string literals.
+class ScopedTimer final {
+public:
+	explicit ScopedTimer(char const* name) noexcept;
+	~ScopedTimer();
+	ScopedTimer(ScopedTimer const&) = delete;
+	auto operator=(ScopedTimer const&) -> ScopedTimer& = delete;
+
+private:
+	char const* name_{ nullptr };	// Only set while profiling
+	std::chrono::steady_clock::time_point start_{};
+};
+void addToCounter(char const* name, uint64_t amount = 1);
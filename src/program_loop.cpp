@@ -5,11 +5,14 @@
 #include <string>
 #include <vector>
 
-#include "calculate_scores.h"
+#include "adaptive_ranking.h"
+#include "constants.h"
 #include "functions.h"
 #include "helpers.h"
 #include "keyboard_input.h"
+#include "mapped_file.h"
 #include "menus.h"
+#include "merge_insertion.h"
 #include "print.h"
 #include "score_helpers.h"
 
@@ -33,6 +36,38 @@ enum class ProgramState {
 	SaveCombinedScores,
 	Quit,
 };
+auto programStateToString(ProgramState const state) -> std::string_view {
+	switch (state) {
+	case ProgramState::MainMenu:
+		return "main_menu";
+	case ProgramState::Voting:
+		return "voting";
+	case ProgramState::CombineScores:
+		return "combine_scores";
+	case ProgramState::SelectItemsFile:
+		return "select_items_file";
+	case ProgramState::SelectFormatAndCreateVotingRound:
+		return "select_format_and_create_voting_round";
+	case ProgramState::LoadVotingRound:
+		return "load_voting_round";
+	case ProgramState::CheckUnsavedVotingRound:
+		return "check_unsaved_voting_round";
+	case ProgramState::SaveVotingRound:
+		return "save_voting_round";
+	case ProgramState::SaveScores:
+		return "save_scores";
+	case ProgramState::SaveRanking:
+		return "save_ranking";
+	case ProgramState::ViewCombinedScores:
+		return "view_combined_scores";
+	case ProgramState::SaveCombinedScores:
+		return "save_combined_scores";
+	case ProgramState::Quit:
+		return "quit";
+	default:
+		return "invalid";
+	}
+}
 
 void mainMenuState(ProgramState& state, bool show_menu) {
 	if (show_menu) {
@@ -82,14 +117,14 @@ void selectItemsFileState(ProgramState& state, Items& items) {
 		printError("File '" + file_name + "' does not exist");
 		return;
 	}
-	auto loaded_items = loadFile(file_name);
-	if (loaded_items.size() < 2) {
+	auto const file = MappedFile::open(file_name);
+	if (!file.has_value() || file.value().lines().size() < 2) {
 		printError("Too few items in '" + file_name + "'. At least two expected.");
 		return;
 	}
 
 	state = ProgramState::SelectFormatAndCreateVotingRound;
-	items = std::move(loaded_items);
+	items.assign(file.value().lines().begin(), file.value().lines().end());
 }
 void selectFormatAndCreateVotingRoundState(ProgramState& state, bool show_menu, Items const& items, std::optional<VotingRound>& voting_round) {
 	if (show_menu) {
@@ -103,6 +138,8 @@ void selectFormatAndCreateVotingRoundState(ProgramState& state, bool show_menu,
 		auto const full_votes = static_cast<uint32_t>(items.size() * (items.size() - 1) / 2);
 		auto const reduced_votes = static_cast<uint32_t>(items.size() * (3 + (items.size() % 2)) / 2);
 		auto const ranking_votes = static_cast<uint32_t>(items.size() * std::log2(items.size()));
+		auto const merge_votes = MergeInsertion::maximumNumberOfVotes(static_cast<uint32_t>(items.size()));
+		auto const adaptive_votes = AdaptiveRanking::estimatedNumberOfVotes(static_cast<uint32_t>(items.size()));
 		print(
 			"---------------------------------------------------\n"
 			"|     Select voting format      | Estimated votes |\n"
@@ -110,6 +147,8 @@ void selectFormatAndCreateVotingRoundState(ProgramState& state, bool show_menu,
 			"|   [F]ull score-based voting   | " + padded_number(full_votes) + " |\n"
 			"|  [R]educed score-based voting | " + padded_number(reduced_votes) + " |\n"
 			"| [I]nsertion rank-based voting | " + padded_number(ranking_votes) + " |\n"
+			"|   [M]erge rank-based voting   | " + padded_number(merge_votes) + " |\n"
+			"|  [A]daptive rank-based voting | " + padded_number(adaptive_votes) + " |\n"
 			"|            [H]elp             |------------------\n"
 			"|           [C]ancel            |\n"
 			"---------------------------------"
@@ -121,6 +160,8 @@ void selectFormatAndCreateVotingRoundState(ProgramState& state, bool show_menu,
 	case 'f':
 	case 'r':
 	case 'i':
+	case 'm':
+	case 'a':
 		voting_round = newRound(characterToVotingFormat(ch), items);
 		if (voting_round.has_value()) {
 			state = ProgramState::Voting;
@@ -157,13 +198,16 @@ void loadVotingRoundState(ProgramState& state, std::optional<VotingRound>& votin
 		printError("File '" + file_name + "' does not exist");
 		return;
 	}
-	auto loaded_lines = loadFile(file_name);
-	if (loaded_lines.empty()) {
-		printError("No lines found in '" + file_name + "'");
-		return;
+	{
+		// Unmapped before loading, which may append votes recovered from a journal to the file
+		auto const file = MappedFile::open(file_name);
+		if (!file.has_value() || file.value().lines().empty()) {
+			printError("No lines found in '" + file_name + "'");
+			return;
+		}
 	}
 
-	voting_round = VotingRound::create(loaded_lines);
+	voting_round = VotingRound::load(file_name);
 	if (!voting_round.has_value()) {
 		printError("Failed to create voting round from '" + file_name + "'");
 		return;
@@ -183,7 +227,7 @@ void saveVotingRoundState(ProgramState& state, VotingRound& voting_round) {
 		state = ProgramState::Voting;
 		return;
 	}
-	if (!voting_round.save(file_name)) {
+	if (!voting_round.startJournal(file_name, kJournalSyncInterval)) {
 		printError("Failed to save voting round to '" + file_name + "'");
 		return;
 	}
@@ -194,6 +238,8 @@ void saveVotingRoundState(ProgramState& state, VotingRound& voting_round) {
 		state = ProgramState::SaveScores;
 		break;
 	case VotingFormat::Ranked:
+	case VotingFormat::MergeInsertion:
+	case VotingFormat::Adaptive:
 		state = ProgramState::SaveRanking;
 		break;
 	case VotingFormat::Invalid:
@@ -217,7 +263,7 @@ void saveScoresState(ProgramState& state, VotingRound const& voting_round) {
 		state = ProgramState::Voting;
 		return;
 	}
-	if (!saveScores(calculateScores(voting_round.items(), voting_round.votes()), file_name)) {
+	if (!saveScores(voting_round.scores(), file_name)) {
 		printError("Failed to save scores to '" + file_name + "'");
 		return;
 	}
@@ -242,16 +288,7 @@ void saveRankingState(ProgramState& state, VotingRound const& voting_round) {
 	}
 
 	// TODO: Clean up and consolidate with score saving
-	auto const& items = voting_round.items();
-	std::string str{};
-	for (size_t i = 0; i < items.size(); i++) {
-		str += items[i];
-		if (i + 1 == voting_round.numberOfSortedItems()) {
-			str += " <-- sorted until here";
-		}
-		str += '\n';
-	}
-	if (!saveFile(file_name, { str })) {
+	if (!saveFile(file_name, { createRanking(voting_round) })) {
 		printError("Failed to save ranking to '" + file_name + "'");
 		return;
 	}
@@ -284,6 +321,8 @@ void checkUnsavedVotingRoundState(ProgramState& state, bool show_menu, VotingRou
 		break;
 	case 'n':
 		print(std::string{ ch });
+		// Leave the saved file as it was
+		voting_round.stopJournal();
 		state = ProgramState::MainMenu;
 		break;
 	case 'c':
@@ -391,18 +430,17 @@ void combineScoresState(ProgramState& state, std::optional<Scores>& combined_sco
 		return;
 	}
 
-	// Load files' contents
-	std::vector<Scores> scores_sets{};
+	// Load files' contents, and combine them in the order the files were given
+	ScoreCombiner combiner{};
 	bool all_scores_valid = true;
-	for (auto const& file_name : file_names) {
-		print("Reading " + file_name);
-		auto const lines = loadFile(file_name);
-		auto const scores = parseScores(lines);
-		if (scores.size() != lines.size()) {
-			printError("File '" + file_name + "' is invalid");
+	for (auto const& score_file : loadScoreFiles(file_names)) {
+		print("Reading " + score_file.file_name);
+		print(score_file.log, false);
+		if (score_file.scores.size() != score_file.number_of_lines) {
+			printError("File '" + score_file.file_name + "' is invalid");
 			all_scores_valid = false;
 		}
-		scores_sets.emplace_back(scores);
+		combiner.add(score_file.scores);
 	}
 	if (!all_scores_valid) {
 		printError("No scores combined");
@@ -410,7 +448,7 @@ void combineScoresState(ProgramState& state, std::optional<Scores>& combined_sco
 	}
 
 	print("Scores were combined");
-	combined_scores = combineScores(scores_sets);
+	combined_scores = combiner.scores();
 	state = ProgramState::ViewCombinedScores;
 }
 void viewCombinedScoresState(ProgramState& state, bool show_menu, Scores const& combined_scores) {
@@ -462,7 +500,7 @@ void saveCombinedScoresState(ProgramState& state, bool show_menu, Scores const&
 	state = ProgramState::MainMenu;
 }
 
-void programLoop() {
+void programLoop(StateTimer const& state_timer) {
 	std::optional<VotingRound> voting_round{};
 	std::optional<Scores> combined_scores{};
 	ProgramState state{ ProgramState::MainMenu };
@@ -472,6 +510,7 @@ void programLoop() {
 
 	while (program_running) {
 		auto const state_on_entry = state;
+		auto const start = (state_timer ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{});
 		switch (state) {
 		case ProgramState::MainMenu:
 			mainMenuState(state, show_menu);
@@ -515,6 +554,9 @@ void programLoop() {
 		default:
 			break;
 		}
+		if (state_timer) {
+			state_timer(programStateToString(state_on_entry), std::chrono::steady_clock::now() - start);
+		}
 		show_menu = (state != state_on_entry);
 	}
 }
@@ -1,3 +1,11 @@
 #pragma once
 
-void programLoop();
+#include <chrono>
+#include <functional>
+#include <string_view>
+
+// Called after each program state has run, with the name of the state and the time it took,
+// including waiting for input
+using StateTimer = std::function<void(std::string_view state, std::chrono::nanoseconds elapsed)>;
+
+void programLoop(StateTimer const& state_timer = {});
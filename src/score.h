@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -10,6 +11,8 @@ struct Score {
 	Item item{};
 	uint32_t wins = 0;
 	uint32_t losses = 0;
+	std::optional<double> strength{};	// Bradley-Terry strength, when the votes behind the score are known
 };
+// Strengths are estimates derived from the votes, so scores are equal when their items, wins and losses are
 auto operator==(Score const& a, Score const& b) -> bool;
 using Scores = std::vector<Score>;
@@ -1,31 +1,145 @@
 #include "score_helpers.h"
 
 #include <algorithm>
+#include <charconv>
+#include <cmath>
 #include <filesystem>
-#include <sstream>
 
 #include "helpers.h"
 #include "print.h"
+#include "profiler.h"
 
 namespace
 {
 
-auto readNextWord(std::stringstream& stream) -> std::string {
-	if (stream.rdbuf()->in_avail() == 0) {
-		printError("No word to read from stream");
+// Score files with strengths start with this line, and have each strength before the wins
+constexpr std::string_view kStrengthHeader = "Strength Wins Losses Item";
+constexpr int kStrengthDecimals = 3;
+
+auto parseNextNumber(std::string_view& str) -> std::optional<uint32_t> {
+	std::string_view const word = nextWord(str);
+	if (word.empty()) {
+		printError("Unable to parse word");
 		return {};
 	}
-	std::string str{};
-	stream >> str;
-	return str;
+	return parseNumber(word);
 }
-auto parseNextNumber(std::stringstream& stream) -> std::optional<uint32_t> {
-	std::string str = readNextWord(stream);
-	if (str.empty()) {
-		printError("Unable to parse word");
+auto parseStrength(std::string_view const str) -> std::optional<double> {
+	double strength = 0.0;
+	auto const [end, error] = std::from_chars(str.data(), str.data() + str.size(), strength);
+	if (str.empty() || error != std::errc{} || end != str.data() + str.size() || !(strength >= 0.0) || std::isinf(strength)) {
+		printError("Unable to parse '" + std::string{ str } + "'. Not a strength");
+		return std::nullopt;
+	}
+	return strength;
+}
+auto parseScoreWithStrength(std::string_view const str) -> Score {
+	std::string_view remaining = str;
+	std::optional<double> const strength = parseStrength(nextWord(remaining));
+	if (!strength.has_value()) {
 		return {};
 	}
-	return parseNumber(str);
+	Score score = parseScore(remaining);
+	score.strength = strength;
+	return score;
+}
+auto hasStrengthHeader(Lines const& lines) -> bool {
+	return !lines.empty() && lines.front() == kStrengthHeader;
+}
+auto parseScoreLines(Lines const& lines) -> Scores {
+	ScopedTimer const timer{ "parseScores" };
+	bool const has_strengths = hasStrengthHeader(lines);
+	Scores scores{};
+	scores.reserve(lines.size());
+	for (size_t i = (has_strengths ? 1 : 0); i < lines.size(); i++) {
+		Score score = (has_strengths ? parseScoreWithStrength(lines[i]) : parseScore(lines[i]));
+		if (score == Score{}) {
+			printError("Invalid score format: " + std::string{ lines[i] });
+			continue;
+		}
+		scores.emplace_back(score);
+	}
+	return scores;
+}
+auto hasStrengths(Scores const& scores) -> bool {
+	return !scores.empty() && std::all_of(scores.begin(), scores.end(),
+		[](Score const& score) {
+			return score.strength.has_value();
+		});
+}
+auto formatStrength(double const strength) -> std::string {
+	char buffer[32]{};
+	auto const end = std::to_chars(buffer, buffer + sizeof(buffer), strength, std::chars_format::fixed, kStrengthDecimals).ptr;
+	return std::string(buffer, end);
+}
+auto displayedStrength(double const strength) -> double {
+	// Strengths are compared as they're displayed, so that the order survives saving and loading
+	return std::round(strength * std::pow(10.0, kStrengthDecimals));
+}
+auto isRankedHigherByNetWins(Score const& a, Score const& b) -> bool {
+	uint32_t const total_votes_a = a.wins + a.losses;
+	uint32_t const total_votes_b = b.wins + b.losses;
+	int32_t const net_wins_a = static_cast<int32_t>(a.wins) - static_cast<int32_t>(a.losses);
+	int32_t const net_wins_b = static_cast<int32_t>(b.wins) - static_cast<int32_t>(b.losses);
+
+
+	// Maybe change algorithm to win ratio-based instead, since it's easier to understand.
+	// float win_ratio_a = static_cast<float>(a.wins) / static_cast<float>(a.losses);
+	// float win_ratio_b = static_cast<float>(b.wins) / static_cast<float>(b.losses);
+	// 
+	// // First, simply compare win ratios. Greater ratio is better.
+	// if (win_ratio_a > win_ratio_b) {
+	// 	return true;
+	// }
+	// if (win_ratio_a < win_ratio_b) {
+	// 	return false;
+	// }
+	// 
+	// // If win ratio is the same, compare total votes to determine confidence.
+	// // For a positive win ratio, more votes is better.
+	// // For a negative win ratio, fewer votes is better.
+	// if (win_ratio_a >= 1.0f) {
+	// 	if (total_votes_a > total_votes_b) {
+	// 		return true;
+	// 	}
+	// 	if (total_votes_a < total_votes_b) {
+	// 		return false;
+	// 	}
+	// }
+	// if (win_ratio_a < 1.0f) {
+	// 	if (total_votes_a > total_votes_b) {
+	// 		return true;
+	// 	}
+	// 	if (total_votes_a < total_votes_b) {
+	// 		return false;
+	// 	}
+	// }
+
+	if (net_wins_a > net_wins_b) {
+		return true;
+	}
+	if (net_wins_a < net_wins_b) {
+		return false;
+	}
+
+	// If score is positive, 
+	if (net_wins_a > 0) {
+		if (total_votes_a < total_votes_b) {
+			return true;
+		}
+		if (total_votes_a > total_votes_b) {
+			return false;
+		}
+	}
+	if (net_wins_a < 0) {
+		if (total_votes_a > total_votes_b) {
+			return true;
+		}
+		if (total_votes_a < total_votes_b) {
+			return false;
+		}
+	}
+	return a.item < b.item;
 }
 
 } // namespace
@@ -33,72 +147,20 @@ auto parseNextNumber(std::stringstream& stream) -> std::optional<uint32_t> {
 
 /* -------------- Print scores -------------- */
 auto sortScores(Scores const& scores) -> Scores {
+	// Items are ranked by strength when every score has one, and by net wins otherwise
+	bool const sort_by_strength = hasStrengths(scores);
 	Scores sorted_scores = scores;
 	std::sort(sorted_scores.begin(), sorted_scores.end(),
-		[](Score const& a, Score const& b) {
-			uint32_t const total_votes_a = a.wins + a.losses;
-			uint32_t const total_votes_b = b.wins + b.losses;
-			int32_t const net_wins_a = static_cast<int32_t>(a.wins) - static_cast<int32_t>(a.losses);
-			int32_t const net_wins_b = static_cast<int32_t>(b.wins) - static_cast<int32_t>(b.losses);
-
-
-			// Maybe change algorithm to win ratio-based instead, since it's easier to understand.
-			// float win_ratio_a = static_cast<float>(a.wins) / static_cast<float>(a.losses);
-			// float win_ratio_b = static_cast<float>(b.wins) / static_cast<float>(b.losses);
-			// 
-			// // First, simply compare win ratios. Greater ratio is better.
-			// if (win_ratio_a > win_ratio_b) {
-			// 	return true;
-			// }
-			// if (win_ratio_a < win_ratio_b) {
-			// 	return false;
-			// }
-			// 
-			// // If win ratio is the same, compare total votes to determine confidence.
-			// // For a positive win ratio, more votes is better.
-			// // For a negative win ratio, fewer votes is better.
-			// if (win_ratio_a >= 1.0f) {
-			// 	if (total_votes_a > total_votes_b) {
-			// 		return true;
-			// 	}
-			// 	if (total_votes_a < total_votes_b) {
-			// 		return false;
-			// 	}
-			// }
-			// if (win_ratio_a < 1.0f) {
-			// 	if (total_votes_a > total_votes_b) {
-			// 		return true;
-			// 	}
-			// 	if (total_votes_a < total_votes_b) {
-			// 		return false;
-			// 	}
-			// }
-
-			if (net_wins_a > net_wins_b) {
-				return true;
-			}
-			if (net_wins_a < net_wins_b) {
-				return false;
-			}
-
-			// If score is positive, 
-			if (net_wins_a > 0) {
-				if (total_votes_a < total_votes_b) {
-					return true;
-				}
-				if (total_votes_a > total_votes_b) {
-					return false;
-				}
-			}
-			if (net_wins_a < 0) {
-				if (total_votes_a > total_votes_b) {
-					return true;
-				}
-				if (total_votes_a < total_votes_b) {
-					return false;
+		[sort_by_strength](Score const& a, Score const& b) {
+			if (sort_by_strength) {
+				double const strength_a = displayedStrength(a.strength.value());
+				double const strength_b = displayedStrength(b.strength.value());
+				if (strength_a != strength_b) {
+					return strength_a > strength_b;
 				}
 			}
-			return a.item < b.item; });
+			return isRankedHigherByNetWins(a, b);
+		});
 	return sorted_scores;
 }
 auto findMaxLengthItem(Scores const& scores) -> size_t {
@@ -131,22 +193,38 @@ auto findMaxLengthLosses(Scores const& scores) -> size_t {
 		}
 	)->losses);
 }
+auto findMaxLengthStrength(Scores const& scores) -> size_t {
+	size_t max_length = 0;
+	for (auto const& score : scores) {
+		if (score.strength.has_value()) {
+			max_length = std::max(max_length, formatStrength(score.strength.value()).size());
+		}
+	}
+	return max_length;
+}
 auto createScoreTable(Scores const& scores) -> std::string {
+	ScopedTimer const timer{ "createScoreTable" };
 	Scores const sorted_scores = sortScores(scores);
+	bool const show_strengths = hasStrengths(sorted_scores);
 
 	std::string const item_header = "Item";
 	std::string const wins_header = "Wins";
 	std::string const losses_header = "Losses";
+	std::string const strength_header = "Strength";
 
 	size_t const item_min_length = item_header.size();
 	size_t const wins_min_length = wins_header.size();
 	size_t const losses_min_length = losses_header.size();
+	size_t const strength_min_length = strength_header.size();
 
 	size_t const item_max_length = std::max(findMaxLengthItem(sorted_scores), item_min_length);
 	size_t const wins_max_length = std::max(findMaxLengthWins(sorted_scores), wins_min_length);
 	size_t const losses_max_length = std::max(findMaxLengthLosses(sorted_scores), losses_min_length);
+	size_t const strength_max_length = std::max(findMaxLengthStrength(sorted_scores), strength_min_length);
 
-	size_t const total_length = 2 + item_max_length + 3 + wins_max_length + 3 + losses_max_length + 2;
+	// The strength column is only shown when every item has a strength
+	size_t const total_length = 2 + item_max_length + 3 + wins_max_length + 3 + losses_max_length + 2 +
+		(show_strengths ? 3 + strength_max_length : 0);
 
 	std::string score_string{};
 
@@ -154,49 +232,73 @@ auto createScoreTable(Scores const& scores) -> std::string {
 	score_string += "| " +
 		std::string(item_max_length - item_min_length, ' ') + item_header + " | " +
 		std::string(wins_max_length - wins_min_length, ' ') + wins_header + " | " +
-		std::string(losses_max_length - losses_min_length, ' ') + losses_header + " |" + '\n';
+		std::string(losses_max_length - losses_min_length, ' ') + losses_header +
+		(show_strengths ? " | " + std::string(strength_max_length - strength_min_length, ' ') + strength_header : "") + " |" + '\n';
 
 	score_string += "|-" +
 		std::string(item_max_length, '-') + "-|-" +
 		std::string(wins_max_length, '-') + "-|-" +
-		std::string(losses_max_length, '-') + "-|" + '\n';
+		std::string(losses_max_length, '-') +
+		(show_strengths ? "-|-" + std::string(strength_max_length, '-') : "") + "-|" + '\n';
 
 	for (Score const& score : sorted_scores) {
 		score_string += "| " +
 			std::string(item_max_length - score.item.size(), ' ') + score.item + " | " +
 			std::string(wins_max_length - numberOfDigits(score.wins), ' ') + std::to_string(score.wins) + " | " +
-			std::string(losses_max_length - numberOfDigits(score.losses), ' ') + std::to_string(score.losses) + " |\n";
+			std::string(losses_max_length - numberOfDigits(score.losses), ' ') + std::to_string(score.losses);
+		if (show_strengths) {
+			std::string const strength = formatStrength(score.strength.value());
+			score_string += " | " + std::string(strength_max_length - strength.size(), ' ') + strength;
+		}
+		score_string += " |\n";
 	}
 	score_string += std::string(total_length, '-') + '\n';
 	return score_string;
 }
 
 /* -------------- Combine scores -------------- */
-void addScore(Scores& scores, Score const& new_score) {
-	auto it = std::find_if(scores.begin(), scores.end(), [&](Score const& score) {
-		return score.item == new_score.item;
-		});
-	if (it == scores.end()) {
-		scores.emplace_back(new_score);
+void ScoreCombiner::add(Score const& score) {
+	ItemId const id = item_table_.intern(score.item);
+	if (id == wins_.size()) {
+		wins_.emplace_back(0);
+		losses_.emplace_back(0);
+		log_strength_sums_.emplace_back(0.0);
+		strength_weights_.emplace_back(0.0);
 	}
-	else {
-		it->wins += new_score.wins;
-		it->losses += new_score.losses;
+	wins_[id] += score.wins;
+	losses_[id] += score.losses;
+	if (score.strength.has_value()) {
+		double const weight = std::max(score.wins + score.losses, 1u);
+		log_strength_sums_[id] += weight * std::log(score.strength.value());
+		strength_weights_[id] += weight;
 	}
 }
-auto addScores(Scores const& scores_a, Scores const& scores_b) -> Scores {
-	Scores combined_scores = scores_a;
-	for (auto const& score : scores_b) {
-		addScore(combined_scores, score);
+void ScoreCombiner::add(Scores const& scores) {
+	// Timed here and when creating the scores, since every way of combining scores goes through both
+	ScopedTimer const timer{ "ScoreCombiner::add" };
+	for (auto const& score : scores) {
+		add(score);
 	}
-	return combined_scores;
+}
+auto ScoreCombiner::scores() const -> Scores {
+	ScopedTimer const timer{ "ScoreCombiner::scores" };
+	Scores scores{};
+	scores.reserve(item_table_.size());
+	for (ItemId id = 0; id < item_table_.size(); id++) {
+		std::optional<double> strength{};
+		if (strength_weights_[id] > 0.0) {
+			strength = std::exp(log_strength_sums_[id] / strength_weights_[id]);
+		}
+		scores.emplace_back(item_table_.name(id), wins_[id], losses_[id], strength);
+	}
+	return scores;
 }
 auto combineScores(std::vector<Scores> const& score_sets) -> Scores {
-	Scores combined_scores{};
+	ScoreCombiner combiner{};
 	for (auto const& scores : score_sets) {
-		combined_scores = addScores(combined_scores, scores);
+		combiner.add(scores);
 	}
-	return combined_scores;
+	return combiner.scores();
 }
 auto verifyFilesExist(std::vector<std::string> const& file_names) -> bool {
 	bool all_files_exist = true;
@@ -209,7 +311,9 @@ auto verifyFilesExist(std::vector<std::string> const& file_names) -> bool {
 	return all_files_exist;
 }
 auto combine(std::string const& file_names_line, std::string const& combined_score_file_name) -> bool {
-	auto const file_names = parseWords(file_names_line);
+	return combine(parseWords(file_names_line), combined_score_file_name);
+}
+auto combine(std::vector<std::string> const& file_names, std::string const& combined_score_file_name) -> bool {
 	if (file_names.size() < 2) {
 		printError("Too few files. No scores combined");
 		return false;
@@ -219,15 +323,15 @@ auto combine(std::string const& file_names_line, std::string const& combined_sco
 		return false;
 	}
 
-	// Load files' contents
-	std::vector<Scores> scores_sets{};
-	for (auto const& file_name : file_names) {
-		print("Reading " + file_name);
-		auto const lines = loadFile(file_name);
-		scores_sets.emplace_back(parseScores(lines));
+	// Load files' contents, and combine them in the order the files were given
+	ScoreCombiner combiner{};
+	for (auto const& score_file : loadScoreFiles(file_names)) {
+		print("Reading " + score_file.file_name);
+		print(score_file.log, false);
+		combiner.add(score_file.scores);
 	}
 
-	Scores const combined_scores = combineScores(scores_sets);
+	Scores const combined_scores = combiner.scores();
 
 	if (!saveFile(combined_score_file_name, generateScoreFileData(sortScores(combined_scores)))) {
 		printError("Couldn't save file \'" + combined_score_file_name + "\'");
@@ -238,53 +342,45 @@ auto combine(std::string const& file_names_line, std::string const& combined_sco
 }
 
 /* -------------- Score conversion -------------- */
-auto parseScore(std::string const& str) -> Score {
-	std::stringstream stream(str);
+auto parseScore(std::string_view const str) -> Score {
+	std::string_view remaining = str;
 
-	std::optional<uint32_t> const wins = parseNextNumber(stream);
+	std::optional<uint32_t> const wins = parseNextNumber(remaining);
 	if (!wins.has_value()) {
 		printError("Unable to parse wins number");
 		return {};
 	}
 
-	std::optional<uint32_t> const losses = parseNextNumber(stream);
+	std::optional<uint32_t> const losses = parseNextNumber(remaining);
 	if (!losses.has_value()) {
 		printError("Unable to parse losses number");
 		return {};
 	}
 
-	// Character length until item name, including the spaces between values
-	size_t const name_offset = numberOfDigits(wins.value()) + 1 + numberOfDigits(losses.value()) + 1;
-
-	if (name_offset >= str.size()) {
+	// Item name starts after the space following the losses number
+	if (remaining.size() < 2) {
 		printError("Invalid score item format: no item name");
 		return {};
 	}
-	std::string const name = str.substr(name_offset);
-	if (name.empty()) {
-		printError("Invalid score item format: empty item name");
-		return {};
-	}
+	std::string_view const name = remaining.substr(1);
 
-	return Score{ name, wins.value(), losses.value() };
+	return Score{ std::string{ name }, wins.value(), losses.value() };
 }
 auto parseScores(std::vector<std::string> const& lines) -> Scores {
-	Scores scores{};
-	scores.reserve(lines.size());
-	for (auto const& line : lines) {
-		Score score = parseScore(line);
-		if (score == Score{}) {
-			printError("Invalid score format: " + line);
-			continue;
-		}
-		scores.emplace_back(score);
-	}
-	return scores;
+	return parseScoreLines(Lines{ lines.begin(), lines.end() });
+}
+auto parseScores(MappedFile const& file) -> Scores {
+	return parseScoreLines(file.lines());
 }
 auto generateScoreFileData(Scores const& scores) -> std::vector<std::string> {
+	bool const save_strengths = hasStrengths(scores);
 	std::vector<std::string> lines{};
+	if (save_strengths) {
+		lines.emplace_back(kStrengthHeader);
+	}
 	for (auto const& score : scores) {
-		lines.emplace_back(std::to_string(score.wins) + " " + std::to_string(score.losses) + " " + score.item);
+		std::string const strength = (save_strengths ? formatStrength(score.strength.value()) + " " : "");
+		lines.emplace_back(strength + std::to_string(score.wins) + " " + std::to_string(score.losses) + " " + score.item);
 	}
 	return lines;
 }
@@ -293,3 +389,17 @@ auto generateScoreFileData(Scores const& scores) -> std::vector<std::string> {
 auto saveScores(Scores const& scores, std::string const file_name) -> bool {
 	return saveFile(file_name, generateScoreFileData(sortScores(scores)));
 }
+auto loadScoreFiles(std::vector<std::string> const& file_names) -> std::vector<ScoreFile> {
+	std::vector<ScoreFile> score_files(file_names.size());
+	runInParallel(file_names.size(), [&](size_t const i) {
+		PrintCapture const capture{};
+		score_files[i].file_name = file_names[i];
+		auto const file = MappedFile::open(file_names[i]);
+		if (file.has_value()) {
+			score_files[i].scores = parseScores(file.value());
+			score_files[i].number_of_lines = file.value().lines().size() - (hasStrengthHeader(file.value().lines()) ? 1 : 0);
+		}
+		score_files[i].log = capture.output();
+		});
+	return score_files;
+}
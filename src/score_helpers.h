@@ -3,25 +3,54 @@
 #include <string>
 #include <vector>
 
+#include "item_table.h"
+#include "mapped_file.h"
 #include "score.h"
 
 /* -------------- Print scores -------------- */
+// Ranks by strength when every score has one, and by net wins otherwise
 auto sortScores(Scores const& scores) -> Scores;
 auto findMaxLengthItem(Scores const& scores) -> size_t;
 auto findMaxLengthWins(Scores const& scores) -> size_t;
 auto findMaxLengthLosses(Scores const& scores) -> size_t;
+auto findMaxLengthStrength(Scores const& scores) -> size_t;
 auto createScoreTable(Scores const& scores) -> std::string;
 
 /* -------------- Combine scores -------------- */
-void addScore(Scores& scores, Score const& new_score);
-auto addScores(Scores const& a, Scores const& b) -> Scores;
+// Sums up wins and losses per item, in place, across any number of added scores.
+// Combined scores are listed in the order their items were first added.
+// Score files don't keep the votes behind them, so strengths can't be fitted again. Instead, an
+// item's strengths are combined as their geometric mean, weighted by the number of votes behind
+// each. Strengths are anchored to the same virtual opponent, so they share a scale across files.
+class ScoreCombiner final {
+public:
+	void add(Score const& score);
+	void add(Scores const& scores);
+	auto scores() const -> Scores;
+
+private:
+	ItemTable item_table_{};
+	std::vector<uint32_t> wins_{};
+	std::vector<uint32_t> losses_{};
+	std::vector<double> log_strength_sums_{};
+	std::vector<double> strength_weights_{};
+};
 auto combineScores(std::vector<Scores> const& score_sets) -> Scores;
 auto combine(std::string const& file_names_line, std::string const& combined_score_file_name) -> bool;
+auto combine(std::vector<std::string> const& file_names, std::string const& combined_score_file_name) -> bool;
 
 /* -------------- Score conversion -------------- */
-auto parseScore(std::string const& str) -> Score;
+auto parseScore(std::string_view const str) -> Score;
 auto parseScores(std::vector<std::string> const& lines) -> Scores;
+auto parseScores(MappedFile const& file) -> Scores;
 auto generateScoreFileData(Scores const& scores) -> std::vector<std::string>;
 
 /* -------------- File management -------------- */
+struct ScoreFile {
+	std::string file_name{};
+	Scores scores{};
+	size_t number_of_lines{ 0 };	// Excluding the strength header, if any
+	std::string log{};	// Output printed while loading and parsing the file
+};
 auto saveScores(Scores const& scores, std::string const file_name) -> bool;
+auto loadScoreFiles(std::vector<std::string> const& file_names) -> std::vector<ScoreFile>;
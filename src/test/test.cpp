@@ -1,5 +1,9 @@
 #include <string>
 
+extern auto test_adaptive_ranking(std::string const&) -> int;
+extern auto test_batch_commands(std::string const&) -> int;
+extern auto test_binary_voting_round(std::string const&) -> int;
+extern auto test_bradley_terry(std::string const&) -> int;
 extern auto test_calculate_scores(std::string const&) -> int;
 extern auto test_combine_scores(std::string const&) -> int;
 extern auto test_create_score_table(std::string const&) -> int;
@@ -11,22 +15,43 @@ extern auto test_generate_score_file_data(std::string const&) -> int;
 extern auto test_generate_voting_round_file_data(std::string const&) -> int;
 extern auto test_get_active_menu_string(std::string const&) -> int;
 extern auto test_item_order_randomized(std::string const&) -> int;
+extern auto test_item_table(std::string const&) -> int;
 extern auto test_load_and_save_file(std::string const&) -> int;
+extern auto test_matchup_bitmap(std::string const&) -> int;
+extern auto test_merge_insertion(std::string const&) -> int;
+extern auto test_order_statistic_tree(std::string const&) -> int;
+extern auto test_pair_schedule(std::string const&) -> int;
 extern auto test_parse_scores(std::string const&) -> int;
 extern auto test_parse_voting_round(std::string const&) -> int;
+extern auto test_profiler(std::string const&) -> int;
 extern auto test_prune_votes(std::string const&) -> int;
 extern auto test_rank_based_voting(std::string const&) -> int;
+extern auto test_running_scores(std::string const&) -> int;
 extern auto test_save_scores(std::string const&) -> int;
 extern auto test_save_votes(std::string const&) -> int;
 extern auto test_shuffle_voting_order(std::string const&) -> int;
 extern auto test_undo(std::string const&) -> int;
 extern auto test_vote(std::string const&) -> int;
+extern auto test_vote_journal(std::string const&) -> int;
+extern auto test_vote_log(std::string const&) -> int;
 extern auto test_voting_format(std::string const&) -> int;
 
 namespace
 {
 
 auto run_test(std::string const& suite, std::string const& test) -> int {
+	if (suite == "test_adaptive_ranking") {
+		return test_adaptive_ranking(test);
+	}
+	if (suite == "test_batch_commands") {
+		return test_batch_commands(test);
+	}
+	if (suite == "test_binary_voting_round") {
+		return test_binary_voting_round(test);
+	}
+	if (suite == "test_bradley_terry") {
+		return test_bradley_terry(test);
+	}
 	if (suite == "test_calculate_scores") {
 		return test_calculate_scores(test);
 	}
@@ -60,21 +85,42 @@ auto run_test(std::string const& suite, std::string const& test) -> int {
 	if (suite == "test_item_order_randomized") {
 		return test_item_order_randomized(test);
 	}
+	if (suite == "test_item_table") {
+		return test_item_table(test);
+	}
 	if (suite == "test_load_and_save_file") {
 		return test_load_and_save_file(test);
 	}
+	if (suite == "test_matchup_bitmap") {
+		return test_matchup_bitmap(test);
+	}
+	if (suite == "test_merge_insertion") {
+		return test_merge_insertion(test);
+	}
+	if (suite == "test_order_statistic_tree") {
+		return test_order_statistic_tree(test);
+	}
+	if (suite == "test_pair_schedule") {
+		return test_pair_schedule(test);
+	}
 	if (suite == "test_parse_scores") {
 		return test_parse_scores(test);
 	}
 	if (suite == "test_parse_voting_round") {
 		return test_parse_voting_round(test);
 	}
+	if (suite == "test_profiler") {
+		return test_profiler(test);
+	}
 	if (suite == "test_prune_votes") {
 		return test_prune_votes(test);
 	}
 	if (suite == "test_rank_based_voting") {
 		return test_rank_based_voting(test);
 	}
+	if (suite == "test_running_scores") {
+		return test_running_scores(test);
+	}
 	if (suite == "test_save_scores") {
 		return test_save_scores(test);
 	}
@@ -90,6 +136,12 @@ auto run_test(std::string const& suite, std::string const& test) -> int {
 	if (suite == "test_vote") {
 		return test_vote(test);
 	}
+	if (suite == "test_vote_journal") {
+		return test_vote_journal(test);
+	}
+	if (suite == "test_vote_log") {
+		return test_vote_log(test);
+	}
 	if (suite == "test_voting_format") {
 		return test_voting_format(test);
 	}
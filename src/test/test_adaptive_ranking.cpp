@@ -0,0 +1,207 @@
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <unordered_set>
+
+#include "adaptive_ranking.h"
+#include "constants.h"
+#include "helpers.h"
+#include "testing.h"
+#include "voting_round.h"
+
+namespace
+{
+
+/* -------------- Test helpers -------------- */
+auto itemNumber(Item const& item) -> int {
+	return std::stoi(item.substr(4));
+}
+void voteByItemNumber(VotingRound& voting_round) {
+	// Lower numbered items are preferred
+	auto const matchup = voting_round.currentMatchup();
+	voting_round.vote(itemNumber(matchup.value().item_a) < itemNumber(matchup.value().item_b) ? Option::A : Option::B);
+}
+auto largestRankError(ItemsView const& items) -> int {
+	int largest_error = 0;
+	for (size_t i = 0; i < items.size(); i++) {
+		largest_error = std::max(largest_error, std::abs(itemNumber(items[i]) - 1 - static_cast<int>(i)));
+	}
+	return largest_error;
+}
+
+/* -------------- Tests -------------- */
+void estimatedNumberOfVotes() {
+	ASSERT_EQ(AdaptiveRanking::estimatedNumberOfVotes(2), 1u);
+	ASSERT_EQ(AdaptiveRanking::estimatedNumberOfVotes(10), 45u);
+	ASSERT_EQ(AdaptiveRanking::estimatedNumberOfVotes(100), 750u);
+	ASSERT_EQ(AdaptiveRanking::estimatedNumberOfVotes(1000), 7500u);
+}
+void rankingFewItemsVotesOnAllMatchups() {
+	auto voting_round = VotingRound::create(getNItems(5), VotingFormat::Adaptive, 12345);
+	voting_round.value().shuffle();
+	while (voting_round.value().hasRemainingVotes()) {
+		voteByItemNumber(voting_round.value());
+	}
+	ASSERT_EQ(static_cast<uint32_t>(voting_round.value().votes().size()), 10u);
+	ASSERT_EQ(voting_round.value().items(), getNItems(5));
+}
+void rankingManyItemsWithFewVotes() {
+	constexpr uint32_t kNumberOfItems = 1'000;
+	auto voting_round = VotingRound::create(getNItems(kNumberOfItems), VotingFormat::Adaptive, 12345);
+	voting_round.value().shuffle();
+	while (voting_round.value().hasRemainingVotes()) {
+		voteByItemNumber(voting_round.value());
+	}
+	ASSERT_TRUE(voting_round.value().votes().size() < sumOfFirstIntegers(kNumberOfItems - 1) / 20);
+	ASSERT_EQ(voting_round.value().numberOfSortedItems(), kNumberOfItems);
+	ASSERT_TRUE(largestRankError(voting_round.value().items()) < static_cast<int>(kNumberOfItems / 20));
+}
+void matchupsAreNeverRepeated() {
+	std::default_random_engine engine(12345);
+	auto voting_round = VotingRound::create(getNItems(30), VotingFormat::Adaptive, 12345);
+	std::unordered_set<IndexPair, IndexPairHash> matchups{};
+	while (voting_round.value().vote(engine() % 2 == 0 ? Option::A : Option::B)) {
+		auto const& vote = voting_round.value().votes().back();
+		ASSERT_TRUE(vote.a_idx != vote.b_idx);
+		ASSERT_TRUE(matchups.insert({ std::min(vote.a_idx, vote.b_idx), std::max(vote.a_idx, vote.b_idx) }).second);
+	}
+	ASSERT_TRUE(VotingRound::create(voting_round.value().convertToText()).has_value());
+}
+void undoVotesDisplaysPreviousMatchups() {
+	auto voting_round = VotingRound::create(getNItems(40), VotingFormat::Adaptive, 12345);
+	voting_round.value().shuffle();
+	std::vector<std::string> voting_lines{};
+	for (uint32_t i = 0; i < 100; i++) {
+		voting_lines.push_back(voting_round.value().currentVotingLine().value());
+		voteByItemNumber(voting_round.value());
+	}
+	while (!voting_lines.empty()) {
+		ASSERT_TRUE(voting_round.value().undoVote());
+		ASSERT_EQ(voting_round.value().currentVotingLine().value(), voting_lines.back());
+		voting_lines.pop_back();
+	}
+	ASSERT_FALSE(voting_round.value().undoVote());
+}
+void savingAndLoadingAdaptiveRound() {
+	auto voting_round = VotingRound::create(getNItems(40), VotingFormat::Adaptive, 12345);
+	voting_round.value().shuffle();
+	for (uint32_t i = 0; i < 100; i++) {
+		voteByItemNumber(voting_round.value());
+	}
+
+	auto loaded_voting_round = VotingRound::create(voting_round.value().convertToText());
+	ASSERT_TRUE(loaded_voting_round.has_value());
+	ASSERT_EQ(loaded_voting_round.value().format(), VotingFormat::Adaptive);
+	ASSERT_EQ(loaded_voting_round.value().currentVotingLine(), voting_round.value().currentVotingLine());
+
+	while (voting_round.value().hasRemainingVotes()) {
+		voteByItemNumber(voting_round.value());
+		voteByItemNumber(loaded_voting_round.value());
+	}
+	ASSERT_FALSE(loaded_voting_round.value().hasRemainingVotes());
+	ASSERT_EQ(loaded_voting_round.value().votes(), voting_round.value().votes());
+	ASSERT_EQ(loaded_voting_round.value().items(), voting_round.value().items());
+}
+void loadingMatchupAgainstSameItem() {
+	auto voting_round = VotingRound::create(getNItems(10), VotingFormat::Adaptive, 12345);
+	ASSERT_FALSE(VotingRound::create(voting_round.value().convertToText() + std::string{ "3 3 0" }).has_value());
+}
+void undoingVotesMatchesLoadingTheRemainingVotes() {
+	std::default_random_engine engine(12345);
+	auto voting_round = VotingRound::create(getNItems(30), VotingFormat::Adaptive, 12345);
+	voting_round.value().shuffle();
+	while (voting_round.value().hasRemainingVotes()) {
+		voting_round.value().vote(engine() % 2 == 0 ? Option::A : Option::B);
+		if (engine() % 3 == 0) {
+			ASSERT_TRUE(voting_round.value().undoVote());
+			auto const loaded_voting_round = VotingRound::create(voting_round.value().convertToText());
+			ASSERT_TRUE(loaded_voting_round.has_value());
+			ASSERT_EQ(loaded_voting_round.value().currentVotingLine(), voting_round.value().currentVotingLine());
+			ASSERT_EQ(loaded_voting_round.value().items(), voting_round.value().items());
+		}
+	}
+}
+void estimatedNumberOfVotesForRatingDeviation() {
+	ASSERT_EQ(AdaptiveRanking::estimatedNumberOfVotes(100, 0.25), 3150u);
+	ASSERT_EQ(AdaptiveRanking::estimatedNumberOfVotes(100, 0.01), 4950u);
+	ASSERT_EQ(AdaptiveRanking::estimatedNumberOfVotes(100, 2.0), 0u);
+}
+void lowerRatingDeviationTakesMoreVotes() {
+	auto const numberOfVotes = [](double const rating_deviation) {
+		auto voting_round = VotingRound::create(getNItems(100), VotingFormat::Adaptive, 12345, rating_deviation);
+		voting_round.value().shuffle();
+		while (voting_round.value().hasRemainingVotes()) {
+			voteByItemNumber(voting_round.value());
+		}
+		return voting_round.value().votes().size();
+	};
+	ASSERT_TRUE(numberOfVotes(0.6) > numberOfVotes(0.7));
+	ASSERT_TRUE(numberOfVotes(0.7) > numberOfVotes(1.0));
+}
+void savingAndLoadingKeepsRatingDeviation() {
+	auto voting_round = VotingRound::create(getNItems(40), VotingFormat::Adaptive, 12345, 0.3);
+	voting_round.value().shuffle();
+	for (uint32_t i = 0; i < 100; i++) {
+		voteByItemNumber(voting_round.value());
+	}
+
+	auto text_voting_round = VotingRound::create(voting_round.value().convertToText());
+	auto binary_voting_round = VotingRound::createFromBinary(voting_round.value().convertToBinary());
+	ASSERT_EQ(text_voting_round.value().adaptiveRatingDeviation(), 0.3);
+	ASSERT_EQ(binary_voting_round.value().adaptiveRatingDeviation(), 0.3);
+	while (voting_round.value().hasRemainingVotes()) {
+		voteByItemNumber(voting_round.value());
+		voteByItemNumber(text_voting_round.value());
+		voteByItemNumber(binary_voting_round.value());
+	}
+	ASSERT_FALSE(text_voting_round.value().hasRemainingVotes());
+	ASSERT_FALSE(binary_voting_round.value().hasRemainingVotes());
+	ASSERT_EQ(text_voting_round.value().votes(), voting_round.value().votes());
+	ASSERT_EQ(binary_voting_round.value().votes(), voting_round.value().votes());
+}
+void loadingWithoutRatingDeviationUsesDefault() {
+	auto const voting_round = VotingRound::create(getNItems(10), VotingFormat::Adaptive, 12345, 0.3);
+	auto lines = voting_round.value().convertToText();
+	ASSERT_EQ(lines[13], std::string{ "rating deviation 0.3" });
+	lines.erase(lines.begin() + 13);
+	ASSERT_EQ(VotingRound::create(lines).value().adaptiveRatingDeviation(), kDefaultAdaptiveRatingDeviation);
+}
+void invalidRatingDeviationIsRejected() {
+	for (double const rating_deviation : { 0.0, -0.5, std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN() }) {
+		ASSERT_FALSE(VotingRound::create(getNItems(10), VotingFormat::Adaptive, 12345, rating_deviation).has_value());
+	}
+	auto lines = VotingRound::create(getNItems(10), VotingFormat::Adaptive, 12345).value().convertToText();
+	for (std::string const line : { "rating deviation 0", "rating deviation -1", "rating deviation x", "rating deviation 0.5x" }) {
+		lines[13] = line;
+		ASSERT_FALSE(VotingRound::create(lines).has_value());
+	}
+	auto const full_lines = VotingRound::create(getNItems(10), VotingFormat::Full, 12345).value().convertToText();
+	ASSERT_FALSE(VotingRound::create(full_lines + std::string{ "rating deviation 0.5" }).has_value());
+}
+
+auto run_tests(std::string const& test) -> bool {
+	RUN_TEST_IF_ARGUMENT_EQUALS(estimatedNumberOfVotes);
+	RUN_TEST_IF_ARGUMENT_EQUALS(rankingFewItemsVotesOnAllMatchups);
+	RUN_TEST_IF_ARGUMENT_EQUALS(rankingManyItemsWithFewVotes);
+	RUN_TEST_IF_ARGUMENT_EQUALS(matchupsAreNeverRepeated);
+	RUN_TEST_IF_ARGUMENT_EQUALS(undoVotesDisplaysPreviousMatchups);
+	RUN_TEST_IF_ARGUMENT_EQUALS(savingAndLoadingAdaptiveRound);
+	RUN_TEST_IF_ARGUMENT_EQUALS(loadingMatchupAgainstSameItem);
+	RUN_TEST_IF_ARGUMENT_EQUALS(undoingVotesMatchesLoadingTheRemainingVotes);
+	RUN_TEST_IF_ARGUMENT_EQUALS(estimatedNumberOfVotesForRatingDeviation);
+	RUN_TEST_IF_ARGUMENT_EQUALS(lowerRatingDeviationTakesMoreVotes);
+	RUN_TEST_IF_ARGUMENT_EQUALS(savingAndLoadingKeepsRatingDeviation);
+	RUN_TEST_IF_ARGUMENT_EQUALS(loadingWithoutRatingDeviationUsesDefault);
+	RUN_TEST_IF_ARGUMENT_EQUALS(invalidRatingDeviationIsRejected);
+	return true;
+}
+
+} // namespace
+
+auto test_adaptive_ranking(std::string const& test_case) -> int {
+	if (run_tests(test_case)) {
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,152 @@
+#include <filesystem>
+
+#include "batch_commands.h"
+#include "helpers.h"
+#include "mapped_file.h"
+#include "score_helpers.h"
+#include "testing.h"
+#include "voting_round.h"
+
+namespace
+{
+
+constexpr auto kItemsFile = "batch_items.txt";
+constexpr auto kVotingRoundFile = "batch_voting_round.txt";
+constexpr auto kVotesFile = "batch_votes.txt";
+constexpr auto kScoresFile = "batch_scores.txt";
+constexpr auto kOtherScoresFile = "batch_other_scores.txt";
+constexpr auto kOutputFile = "batch_output.txt";
+
+/* -------------- Test helpers -------------- */
+void removeFiles() {
+	for (auto const file_name : { kItemsFile, kVotingRoundFile, kVotesFile, kScoresFile, kOtherScoresFile, kOutputFile }) {
+		std::filesystem::remove(file_name);
+	}
+}
+auto run(std::vector<std::string> const& arguments) -> ExitCode {
+	return static_cast<ExitCode>(runBatchCommand(arguments));
+}
+auto loadVotingRound() -> std::optional<VotingRound> {
+	auto const file = MappedFile::open(kVotingRoundFile);
+	if (!file.has_value()) {
+		return std::nullopt;
+	}
+	return VotingRound::create(file.value());
+}
+void createVotingRound(uint32_t const number_of_items, std::string const& format) {
+	ASSERT_TRUE(saveFile(kItemsFile, getNItems(number_of_items)));
+	ASSERT_EQ(run({ "new", kItemsFile, format, kVotingRoundFile, "12345" }), ExitCode::Success);
+}
+
+/* -------------- Tests -------------- */
+void newVotingRound() {
+	createVotingRound(5, "full");
+	auto const voting_round = loadVotingRound();
+	ASSERT_TRUE(voting_round.has_value());
+	ASSERT_EQ(voting_round.value().format(), VotingFormat::Full);
+	ASSERT_EQ(voting_round.value().seed(), 12345u);
+	ASSERT_TRUE(voting_round.value().votes().empty());
+}
+void newAdaptiveVotingRoundWithRatingDeviation() {
+	ASSERT_TRUE(saveFile(kItemsFile, getNItems(5)));
+	ASSERT_EQ(run({ "new", kItemsFile, "adaptive", kVotingRoundFile, "12345", "0.3" }), ExitCode::Success);
+	auto const voting_round = loadVotingRound();
+	ASSERT_TRUE(voting_round.has_value());
+	ASSERT_EQ(voting_round.value().adaptiveRatingDeviation(), 0.3);
+}
+void newVotingRoundWithInvalidArguments() {
+	ASSERT_TRUE(saveFile(kItemsFile, getNItems(5)));
+	ASSERT_EQ(run({ "new", kItemsFile, "invalid", kVotingRoundFile }), ExitCode::InvalidArguments);
+	ASSERT_EQ(run({ "new", kItemsFile, "full", kVotingRoundFile, "seed" }), ExitCode::InvalidArguments);
+	ASSERT_EQ(run({ "new", kItemsFile, "full" }), ExitCode::InvalidArguments);
+	ASSERT_EQ(run({ "new", kItemsFile, "adaptive", kVotingRoundFile, "12345", "0" }), ExitCode::InvalidArguments);
+	ASSERT_EQ(run({ "new", kItemsFile, "full", kVotingRoundFile, "12345", "0.3" }), ExitCode::InvalidArguments);
+	ASSERT_FALSE(std::filesystem::exists(kVotingRoundFile));
+
+	ASSERT_TRUE(saveFile(kItemsFile, getNItems(1)));
+	ASSERT_EQ(run({ "new", kItemsFile, "full", kVotingRoundFile }), ExitCode::Failure);
+	ASSERT_FALSE(std::filesystem::exists(kVotingRoundFile));
+}
+void votingFromFile() {
+	createVotingRound(5, "full");
+	ASSERT_TRUE(saveFile(kVotesFile, { "a b", "Ab", "u" }));
+	ASSERT_EQ(run({ "vote", kVotingRoundFile, kVotesFile }), ExitCode::Success);
+	auto const voting_round = loadVotingRound();
+	ASSERT_EQ(voting_round.value().votes().size(), 3ui64);
+	ASSERT_EQ(voting_round.value().votes()[0].winner, Option::A);
+	ASSERT_EQ(voting_round.value().votes()[1].winner, Option::B);
+	ASSERT_EQ(voting_round.value().votes()[2].winner, Option::A);
+}
+void votingIsNotSavedWhenAnyVoteFails() {
+	createVotingRound(3, "full");
+	ASSERT_TRUE(saveFile(kVotesFile, { "ab x" }));
+	ASSERT_EQ(run({ "vote", kVotingRoundFile, kVotesFile }), ExitCode::Failure);
+	ASSERT_TRUE(saveFile(kVotesFile, { "aaaa" }));
+	ASSERT_EQ(run({ "vote", kVotingRoundFile, kVotesFile }), ExitCode::Failure);
+	ASSERT_TRUE(saveFile(kVotesFile, { "au", "u" }));
+	ASSERT_EQ(run({ "vote", kVotingRoundFile, kVotesFile }), ExitCode::Failure);
+	ASSERT_TRUE(loadVotingRound().value().votes().empty());
+}
+void savingScores() {
+	createVotingRound(4, "full");
+	ASSERT_TRUE(saveFile(kVotesFile, { "abaaba" }));
+	ASSERT_EQ(run({ "vote", kVotingRoundFile, kVotesFile }), ExitCode::Success);
+	ASSERT_EQ(run({ "scores", kVotingRoundFile, kScoresFile }), ExitCode::Success);
+	auto const file = MappedFile::open(kScoresFile);
+	ASSERT_EQ(parseScores(file.value()), sortScores(loadVotingRound().value().scores()));
+	ASSERT_EQ(run({ "ranking", kVotingRoundFile, kOutputFile }), ExitCode::Failure);
+}
+void savingRanking() {
+	createVotingRound(4, "merge");
+	ASSERT_TRUE(saveFile(kVotesFile, { "aaa" }));
+	ASSERT_EQ(run({ "vote", kVotingRoundFile, kVotesFile }), ExitCode::Success);
+	ASSERT_EQ(run({ "ranking", kVotingRoundFile, kOutputFile }), ExitCode::Success);
+	ASSERT_EQ(loadFile(kOutputFile).front(), loadVotingRound().value().items()[0]);
+	ASSERT_EQ(run({ "scores", kVotingRoundFile, kScoresFile }), ExitCode::Failure);
+}
+void combiningScores() {
+	ASSERT_TRUE(saveFile(kScoresFile, { "2 1 item1", "1 2 item2" }));
+	ASSERT_TRUE(saveFile(kOtherScoresFile, { "3 0 item2" }));
+	ASSERT_EQ(run({ "combine", kOutputFile, kScoresFile, kOtherScoresFile }), ExitCode::Success);
+	ASSERT_EQ(parseScores(loadFile(kOutputFile)), (Scores{ { "item2", 4, 2 }, { "item1", 2, 1 } }));
+	ASSERT_EQ(run({ "combine", kOutputFile, kScoresFile }), ExitCode::InvalidArguments);
+}
+void convertingVotingRound() {
+	createVotingRound(4, "reduced");
+	ASSERT_EQ(run({ "convert", kVotingRoundFile, kOutputFile }), ExitCode::Success);
+	auto const file = MappedFile::open(kOutputFile);
+	auto const converted_voting_round = VotingRound::create(file.value());
+	ASSERT_TRUE(converted_voting_round.has_value());
+	ASSERT_EQ(converted_voting_round.value().encoding(), VotingRoundEncoding::Binary);
+}
+void unknownCommand() {
+	ASSERT_EQ(run({}), ExitCode::InvalidArguments);
+	ASSERT_EQ(run({ "unknown" }), ExitCode::InvalidArguments);
+	ASSERT_EQ(run({ "help" }), ExitCode::Success);
+}
+
+auto run_tests(std::string const& test) -> bool {
+	RUN_TEST_IF_ARGUMENT_EQUALS(removeFiles);
+	RUN_TEST_IF_ARGUMENT_EQUALS(newVotingRound);
+	RUN_TEST_IF_ARGUMENT_EQUALS(newAdaptiveVotingRoundWithRatingDeviation);
+	RUN_TEST_IF_ARGUMENT_EQUALS(newVotingRoundWithInvalidArguments);
+	RUN_TEST_IF_ARGUMENT_EQUALS(votingFromFile);
+	RUN_TEST_IF_ARGUMENT_EQUALS(votingIsNotSavedWhenAnyVoteFails);
+	RUN_TEST_IF_ARGUMENT_EQUALS(savingScores);
+	RUN_TEST_IF_ARGUMENT_EQUALS(savingRanking);
+	RUN_TEST_IF_ARGUMENT_EQUALS(combiningScores);
+	RUN_TEST_IF_ARGUMENT_EQUALS(convertingVotingRound);
+	RUN_TEST_IF_ARGUMENT_EQUALS(unknownCommand);
+	return true;
+}
+
+} // namespace
+
+auto test_batch_commands(std::string const& test_case) -> int {
+	removeFiles();
+	if (run_tests(test_case)) {
+		return 1;
+	}
+	removeFiles();
+	return 0;
+}
@@ -0,0 +1,153 @@
+#include <filesystem>
+
+#include "binary_io.h"
+#include "functions.h"
+#include "helpers.h"
+#include "mapped_file.h"
+#include "testing.h"
+#include "voting_round.h"
+
+namespace
+{
+
+constexpr char const* kTextFileName = "test_binary_voting_round.txt";
+constexpr char const* kBinaryFileName = "test_binary_voting_round.bin";
+
+/* -------------- Test helpers -------------- */
+auto createVotedRound(VotingFormat const voting_format, uint32_t const number_of_votes) -> VotingRound {
+	auto voting_round = VotingRound::create(getNItems(10), voting_format, 12345);
+	voting_round.value().shuffle();
+	for (uint32_t i = 0; i < number_of_votes; i++) {
+		voting_round.value().vote(i % 3 == 0 ? Option::A : Option::B);
+	}
+	return voting_round.value();
+}
+void assertSameVotingRound(VotingRound const& a, VotingRound const& b) {
+	ASSERT_EQ(a.originalItemOrder(), b.originalItemOrder());
+	ASSERT_EQ(a.items(), b.items());
+	ASSERT_EQ(a.format(), b.format());
+	ASSERT_EQ(a.seed(), b.seed());
+	ASSERT_EQ(a.votes(), b.votes());
+	ASSERT_EQ(a.currentVotingLine(), b.currentVotingLine());
+}
+
+/* -------------- Tests -------------- */
+void varintsAreReadAsWritten() {
+	std::vector<uint64_t> const values{ 0, 1, 127, 128, 300, 16383, 16384, 4294967295, 18446744073709551615ull };
+	BinaryWriter writer{};
+	for (auto const value : values) {
+		writer.writeVarint(value);
+	}
+	BinaryReader reader{ writer.data() };
+	for (auto const value : values) {
+		ASSERT_EQ(reader.readVarint().value(), value);
+	}
+	ASSERT_TRUE(reader.atEnd());
+	ASSERT_FALSE(reader.readVarint().has_value());
+}
+void binaryRoundTripForEachFormat() {
+	for (auto const voting_format : { VotingFormat::Full, VotingFormat::Reduced, VotingFormat::Ranked }) {
+		for (uint32_t number_of_votes : { 0, 1, 10 }) {
+			auto const voting_round = createVotedRound(voting_format, number_of_votes);
+			auto const loaded_voting_round = VotingRound::createFromBinary(voting_round.convertToBinary());
+			ASSERT_TRUE(loaded_voting_round.has_value());
+			assertSameVotingRound(loaded_voting_round.value(), voting_round);
+			ASSERT_TRUE(loaded_voting_round.value().encoding() == VotingRoundEncoding::Binary);
+		}
+	}
+}
+void binaryIsSmallerThanText() {
+	auto const voting_round = createVotedRound(VotingFormat::Full, 40);
+	size_t text_size = 0;
+	for (auto const& line : voting_round.convertToText()) {
+		text_size += line.size() + 1;
+	}
+	ASSERT_TRUE(voting_round.convertToBinary().size() < text_size);
+}
+void truncatedBinaryIsRejected() {
+	auto const data = createVotedRound(VotingFormat::Full, 10).convertToBinary();
+	for (size_t size = 0; size < data.size(); size++) {
+		ASSERT_FALSE(VotingRound::createFromBinary(std::string_view{ data }.substr(0, size)).has_value());
+	}
+}
+void unsupportedVersionIsRejected() {
+	auto data = createVotedRound(VotingFormat::Full, 10).convertToBinary();
+	data[4]++;
+	ASSERT_FALSE(VotingRound::createFromBinary(data).has_value());
+}
+void savingAndLoadingSniffsEncoding() {
+	auto voting_round = createVotedRound(VotingFormat::Ranked, 10);
+	ASSERT_TRUE(voting_round.save(kTextFileName));
+	voting_round.setEncoding(VotingRoundEncoding::Binary);
+	ASSERT_TRUE(voting_round.save(kBinaryFileName));
+
+	auto const text_file = MappedFile::open(kTextFileName);
+	auto const binary_file = MappedFile::open(kBinaryFileName);
+	auto const text_voting_round = VotingRound::create(text_file.value());
+	auto const binary_voting_round = VotingRound::create(binary_file.value());
+	ASSERT_TRUE(text_voting_round.value().encoding() == VotingRoundEncoding::Text);
+	ASSERT_TRUE(binary_voting_round.value().encoding() == VotingRoundEncoding::Binary);
+	assertSameVotingRound(text_voting_round.value(), voting_round);
+	assertSameVotingRound(binary_voting_round.value(), voting_round);
+}
+void convertingBetweenEncodings() {
+	auto const voting_round = createVotedRound(VotingFormat::Reduced, 10);
+	ASSERT_TRUE(saveFile(kTextFileName, voting_round.convertToText()));
+
+	ASSERT_TRUE(convertVotingRoundFile(kTextFileName, kBinaryFileName));
+	auto const binary_file = MappedFile::open(kBinaryFileName);
+	ASSERT_EQ(std::string{ binary_file.value().data() }, voting_round.convertToBinary());
+
+	std::filesystem::remove(kTextFileName);
+	ASSERT_TRUE(convertVotingRoundFile(kBinaryFileName, kTextFileName));
+	ASSERT_EQ(loadFile(kTextFileName), voting_round.convertToText());
+}
+void varintsWiderThan64BitsAreRejected() {
+	// Nine bytes of continued zeros, then a tenth byte with bits above bit 63
+	std::string const overflowing = std::string(9, static_cast<char>(0x80)) + static_cast<char>(0x02);
+	ASSERT_FALSE(BinaryReader{ overflowing }.readVarint().has_value());
+
+	// The tenth byte may still hold bit 63
+	std::string const top_bit = std::string(9, static_cast<char>(0x80)) + static_cast<char>(0x01);
+	ASSERT_EQ(BinaryReader{ top_bit }.readVarint().value(), uint64_t{ 1 } << 63);
+}
+void itemsWhichCantBeWrittenAsTextAreRejected() {
+	auto const data = VotingRound::create(Items{ "first", "x", "third" }, VotingFormat::Full).value().convertToBinary();
+	ASSERT_TRUE(VotingRound::createFromBinary(data).has_value());
+
+	// Items are stored as their length followed by their characters
+	for (std::string const line_break : { "\n", "\r" }) {
+		auto with_line_break = data;
+		with_line_break.replace(with_line_break.find("third"), 5, "th" + line_break + "rd");
+		ASSERT_FALSE(VotingRound::createFromBinary(with_line_break).has_value());
+	}
+	auto with_empty_item = data;
+	with_empty_item.replace(with_empty_item.find("\x01x"), 2, std::string(1, '\0'));
+	ASSERT_FALSE(VotingRound::createFromBinary(with_empty_item).has_value());
+}
+
+auto run_tests(std::string const& test) -> bool {
+	RUN_TEST_IF_ARGUMENT_EQUALS(varintsAreReadAsWritten);
+	RUN_TEST_IF_ARGUMENT_EQUALS(binaryRoundTripForEachFormat);
+	RUN_TEST_IF_ARGUMENT_EQUALS(binaryIsSmallerThanText);
+	RUN_TEST_IF_ARGUMENT_EQUALS(truncatedBinaryIsRejected);
+	RUN_TEST_IF_ARGUMENT_EQUALS(unsupportedVersionIsRejected);
+	RUN_TEST_IF_ARGUMENT_EQUALS(savingAndLoadingSniffsEncoding);
+	RUN_TEST_IF_ARGUMENT_EQUALS(convertingBetweenEncodings);
+	RUN_TEST_IF_ARGUMENT_EQUALS(varintsWiderThan64BitsAreRejected);
+	RUN_TEST_IF_ARGUMENT_EQUALS(itemsWhichCantBeWrittenAsTextAreRejected);
+	return true;
+}
+
+} // namespace
+
+auto test_binary_voting_round(std::string const& test_case) -> int {
+	std::filesystem::remove(kTextFileName);
+	std::filesystem::remove(kBinaryFileName);
+	if (run_tests(test_case)) {
+		return 1;
+	}
+	std::filesystem::remove(kTextFileName);
+	std::filesystem::remove(kBinaryFileName);
+	return 0;
+}
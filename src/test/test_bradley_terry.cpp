@@ -0,0 +1,108 @@
+#include <cmath>
+#include <random>
+
+#include "bradley_terry.h"
+#include "testing.h"
+
+namespace
+{
+
+/* -------------- Test helpers -------------- */
+auto winVote(Index const winner, Index const loser) -> Vote {
+	return Vote{ winner, loser, Option::A };
+}
+auto isMaximumLikelihood(size_t const number_of_items, VoteLog const& votes, std::vector<double> const& strengths) -> bool {
+	// Each item's expected number of wins, including the virtual matchups against strength 1,
+	// equals its actual number of wins
+	std::vector<double> wins(number_of_items, 1.0);
+	std::vector<double> expected_wins(number_of_items, 0.0);
+	for (Index i = 0; i < number_of_items; i++) {
+		expected_wins[i] = 2.0 * strengths[i] / (strengths[i] + 1.0);
+	}
+	for (Vote const vote : votes) {
+		wins[vote.winner == Option::A ? vote.a_idx : vote.b_idx] += 1.0;
+		double const strength_sum = strengths[vote.a_idx] + strengths[vote.b_idx];
+		expected_wins[vote.a_idx] += strengths[vote.a_idx] / strength_sum;
+		expected_wins[vote.b_idx] += strengths[vote.b_idx] / strength_sum;
+	}
+	for (Index i = 0; i < number_of_items; i++) {
+		if (std::abs(expected_wins[i] - wins[i]) > 1e-4 * wins[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+auto randomVotes(size_t const number_of_items, size_t const number_of_votes) -> VoteLog {
+	std::default_random_engine engine(12345);
+	VoteLog votes{};
+	for (size_t i = 0; i < number_of_votes; i++) {
+		Index const a_idx = static_cast<Index>(engine() % number_of_items);
+		Index const b_idx = static_cast<Index>((a_idx + 1 + engine() % (number_of_items - 1)) % number_of_items);
+		// Lower indices win more often
+		votes.append({ a_idx, b_idx, (engine() % number_of_items) + a_idx < number_of_items ? Option::A : Option::B });
+	}
+	return votes;
+}
+
+/* -------------- Tests -------------- */
+void repeatedMatchupsAreMerged() {
+	auto const matrix = WinMatrix::create(4, { winVote(0, 1), winVote(1, 0), winVote(0, 1), winVote(2, 0) });
+	ASSERT_EQ(matrix.numberOfItems(), 4ui64);
+	ASSERT_EQ(matrix.numberOfOpponents(0), 2ui64);
+	ASSERT_EQ(matrix.numberOfOpponents(1), 1ui64);
+	ASSERT_EQ(matrix.numberOfOpponents(2), 1ui64);
+	ASSERT_EQ(matrix.numberOfOpponents(3), 0ui64);
+}
+void itemsWithoutVotesHaveAverageStrength() {
+	ASSERT_TRUE(WinMatrix::create(0, {}).fitStrengths().empty());
+	ASSERT_EQ(WinMatrix::create(3, {}).fitStrengths(), std::vector<double>(3, 1.0));
+}
+void strengthsFollowRoundRobinWins() {
+	// Lower indices beat all higher indices
+	VoteLog votes{};
+	for (Index a = 0; a < 10; a++) {
+		for (Index b = a + 1; b < 10; b++) {
+			votes.append(winVote(a, b));
+		}
+	}
+	auto const strengths = WinMatrix::create(10, votes).fitStrengths();
+	for (size_t i = 1; i < strengths.size(); i++) {
+		ASSERT_TRUE(strengths[i - 1] > strengths[i]);
+	}
+	ASSERT_TRUE(isMaximumLikelihood(10, votes, strengths));
+}
+void winsAgainstStrongerOpponentsCountMore() {
+	// Items 0 and 3 have one win each, but item 0 beat the stronger item
+	VoteLog const votes{ winVote(0, 1), winVote(1, 2), winVote(1, 2), winVote(3, 2) };
+	auto const strengths = WinMatrix::create(4, votes).fitStrengths();
+	ASSERT_TRUE(strengths[0] > strengths[3]);
+	ASSERT_TRUE(isMaximumLikelihood(4, votes, strengths));
+}
+void strengthsAreMaximumLikelihood() {
+	VoteLog const votes = randomVotes(50, 500);
+	ASSERT_TRUE(isMaximumLikelihood(50, votes, WinMatrix::create(50, votes).fitStrengths()));
+}
+void fittingManyItemsInParallel() {
+	constexpr size_t kNumberOfItems = 20'000;
+	VoteLog const votes = randomVotes(kNumberOfItems, 10 * kNumberOfItems);
+	ASSERT_TRUE(isMaximumLikelihood(kNumberOfItems, votes, WinMatrix::create(kNumberOfItems, votes).fitStrengths()));
+}
+
+auto run_tests(std::string const& test) -> bool {
+	RUN_TEST_IF_ARGUMENT_EQUALS(repeatedMatchupsAreMerged);
+	RUN_TEST_IF_ARGUMENT_EQUALS(itemsWithoutVotesHaveAverageStrength);
+	RUN_TEST_IF_ARGUMENT_EQUALS(strengthsFollowRoundRobinWins);
+	RUN_TEST_IF_ARGUMENT_EQUALS(winsAgainstStrongerOpponentsCountMore);
+	RUN_TEST_IF_ARGUMENT_EQUALS(strengthsAreMaximumLikelihood);
+	RUN_TEST_IF_ARGUMENT_EQUALS(fittingManyItemsInParallel);
+	return true;
+}
+
+} // namespace
+
+auto test_bradley_terry(std::string const& test_case) -> int {
+	if (run_tests(test_case)) {
+		return 1;
+	}
+	return 0;
+}
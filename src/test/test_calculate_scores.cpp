@@ -20,21 +20,21 @@ void zeroVotes() {
 }
 void oneVoteForA() {
 	uint64_t const kNumberOfItems{ 2 };
-	auto const scores = calculateScores(getNItems(kNumberOfItems), Votes{ Vote{ 0, 1, Option::A } });
+	auto const scores = calculateScores(getNItems(kNumberOfItems), VoteLog{ Vote{ 0, 1, Option::A } });
 	ASSERT_EQ(scores.size(), kNumberOfItems);
 	ASSERT_EQ(findScoreForItem(scores, "item1"), Score{ "item1", 1, 0 });
 	ASSERT_EQ(findScoreForItem(scores, "item2"), Score{ "item2", 0, 1 });
 }
 void oneVoteForB() {
 	uint64_t const kNumberOfItems{ 2 };
-	auto const scores = calculateScores(getNItems(kNumberOfItems), Votes{ Vote{ 0, 1, Option::B } });
+	auto const scores = calculateScores(getNItems(kNumberOfItems), VoteLog{ Vote{ 0, 1, Option::B } });
 	ASSERT_EQ(scores.size(), kNumberOfItems);
 	ASSERT_EQ(findScoreForItem(scores, "item1"), Score{ "item1", 0, 1 });
 	ASSERT_EQ(findScoreForItem(scores, "item2"), Score{ "item2", 1, 0 });
 }
 void allVotesForA() {
 	uint64_t const kNumberOfItems{ 4 };
-	auto const scores = calculateScores(getNItems(kNumberOfItems), Votes{
+	auto const scores = calculateScores(getNItems(kNumberOfItems), VoteLog{
 		Vote{ 0, 1, Option::A },
 		Vote{ 0, 2, Option::A },
 		Vote{ 0, 3, Option::A },
@@ -52,7 +52,7 @@ void allVotesForA() {
 }
 void allVotesForB() {
 	uint64_t const kNumberOfItems{ 4 };
-	auto const scores = calculateScores(getNItems(kNumberOfItems), Votes{
+	auto const scores = calculateScores(getNItems(kNumberOfItems), VoteLog{
 		Vote{ 0, 1, Option::B },
 		Vote{ 0, 2, Option::B },
 		Vote{ 0, 3, Option::B },
@@ -71,7 +71,7 @@ void allVotesForB() {
 void votingForItem2AndOptionAIfNotPresent() {
 	uint64_t const kNumberOfItems{ 4 };
 	// ASSUMPTION: With getNItems(), item2 will be the second element (index 1)
-	auto const scores = calculateScores(getNItems(kNumberOfItems), Votes{
+	auto const scores = calculateScores(getNItems(kNumberOfItems), VoteLog{
 		Vote{ 0, 1, Option::B },
 		Vote{ 0, 2, Option::A },
 		Vote{ 0, 3, Option::A },
@@ -91,7 +91,7 @@ void votingForItem2AndOptionAIfNotPresent() {
 void votingForItem3AndOptionAIfNotPresent() {
 	uint64_t const kNumberOfItems{ 4 };
 	// ASSUMPTION: With getNItems(), item3 will be the third element (index 2)
-	auto const scores = calculateScores(getNItems(kNumberOfItems), Votes{
+	auto const scores = calculateScores(getNItems(kNumberOfItems), VoteLog{
 		Vote{ 0, 1, Option::A },
 		Vote{ 0, 2, Option::B },
 		Vote{ 0, 3, Option::A },
@@ -111,7 +111,7 @@ void votingForItem3AndOptionAIfNotPresent() {
 void votingForItem2AndOptionBIfNotPresent() {
 	uint64_t const kNumberOfItems{ 4 };
 	// ASSUMPTION: With getNItems(), item2 will be the second element (index 1)
-	auto const scores = calculateScores(getNItems(kNumberOfItems), Votes{
+	auto const scores = calculateScores(getNItems(kNumberOfItems), VoteLog{
 		Vote{ 0, 1, Option::B },
 		Vote{ 0, 2, Option::B },
 		Vote{ 0, 3, Option::B },
@@ -131,7 +131,7 @@ void votingForItem2AndOptionBIfNotPresent() {
 void votingForItem3AndOptionBIfNotPresent() {
 	uint64_t const kNumberOfItems{ 4 };
 	// ASSUMPTION: With getNItems(), item3 will be the third element (index 2)
-	auto const scores = calculateScores(getNItems(kNumberOfItems), Votes{
+	auto const scores = calculateScores(getNItems(kNumberOfItems), VoteLog{
 		Vote{ 0, 1, Option::B },
 		Vote{ 0, 2, Option::B },
 		Vote{ 0, 3, Option::B },
@@ -151,7 +151,7 @@ void votingForItem3AndOptionBIfNotPresent() {
 void votingForItem2AndAgainstItem3AndOptionAIfNeither() {
 	uint64_t const kNumberOfItems{ 4 };
 	// ASSUMPTION: With getNItems(), item2 and item3 will be the second and third element respectively (index 1 and 2)
-	auto const scores = calculateScores(getNItems(kNumberOfItems), Votes{
+	auto const scores = calculateScores(getNItems(kNumberOfItems), VoteLog{
 		Vote{ 0, 1, Option::B },
 		Vote{ 0, 2, Option::A },
 		Vote{ 0, 3, Option::A },
@@ -171,7 +171,7 @@ void votingForItem2AndAgainstItem3AndOptionAIfNeither() {
 void votingForItem2AndAgainstItem3AndOptionBIfNeither() {
 	uint64_t const kNumberOfItems{ 4 };
 	// ASSUMPTION: With getNItems(), item2 and item3 will be the second and third element respectively (index 1 and 2)
-	auto const scores = calculateScores(getNItems(kNumberOfItems), Votes{
+	auto const scores = calculateScores(getNItems(kNumberOfItems), VoteLog{
 		Vote{ 0, 1, Option::B },
 		Vote{ 0, 2, Option::A },
 		Vote{ 0, 3, Option::B },
@@ -191,7 +191,7 @@ void votingForItem2AndAgainstItem3AndOptionBIfNeither() {
 void votingForItem3AndAgainstItem2AndOptionAIfNeither() {
 	uint64_t const kNumberOfItems{ 4 };
 	// ASSUMPTION: With getNItems(), item2 and item3 will be the second and third element respectively (index 1 and 2)
-	auto const scores = calculateScores(getNItems(kNumberOfItems), Votes{
+	auto const scores = calculateScores(getNItems(kNumberOfItems), VoteLog{
 		Vote{ 0, 1, Option::A },
 		Vote{ 0, 2, Option::B },
 		Vote{ 0, 3, Option::A },
@@ -211,7 +211,7 @@ void votingForItem3AndAgainstItem2AndOptionAIfNeither() {
 void votingForItem3AndAgainstItem2AndOptionBIfNeither() {
 	uint64_t const kNumberOfItems{ 4 };
 	// ASSUMPTION: With getNItems(), item2 and item3 will be the second and third element respectively (index 1 and 2)
-	auto const scores = calculateScores(getNItems(kNumberOfItems), Votes{
+	auto const scores = calculateScores(getNItems(kNumberOfItems), VoteLog{
 		Vote{ 0, 1, Option::A },
 		Vote{ 0, 2, Option::B },
 		Vote{ 0, 3, Option::B },
@@ -230,7 +230,7 @@ void votingForItem3AndAgainstItem2AndOptionBIfNeither() {
 }
 void votingForOptionAButNotFullRound() {
 	uint64_t const kNumberOfItems{ 4 };
-	auto const scores = calculateScores(getNItems(kNumberOfItems), Votes{
+	auto const scores = calculateScores(getNItems(kNumberOfItems), VoteLog{
 		Vote{ 0, 1, Option::A },
 		Vote{ 0, 2, Option::A },
 		Vote{ 0, 3, Option::A },
@@ -245,7 +245,7 @@ void votingForOptionAButNotFullRound() {
 }
 void votingForOptionBButNotFullRound() {
 	uint64_t const kNumberOfItems{ 4 };
-	auto const scores = calculateScores(getNItems(kNumberOfItems), Votes{
+	auto const scores = calculateScores(getNItems(kNumberOfItems), VoteLog{
 		Vote{ 0, 1, Option::B },
 		Vote{ 0, 2, Option::B },
 		Vote{ 0, 3, Option::B },
@@ -260,14 +260,26 @@ void votingForOptionBButNotFullRound() {
 }
 void tooFewVotesToScoreAllItems() {
 	uint64_t const kNumberOfItems{ 5 };
-	auto const scores = calculateScores(getNItems(kNumberOfItems), Votes{
+	auto const scores = calculateScores(getNItems(kNumberOfItems), VoteLog{
 		Vote{ 0, 1, Option::A },
 		Vote{ 0, 2, Option::A },
 		Vote{ 0, 3, Option::A },
 		});
 	ASSERT_TRUE(scores.size() < kNumberOfItems);
 }
-
+void scoresAreInOrderOfFirstAppearance() {
+	auto const scores = calculateScores(getNItems(4), VoteLog{
+		Vote{ 2, 3, Option::B },
+		Vote{ 0, 2, Option::A },
+		Vote{ 1, 3, Option::A },
+		});
+	ASSERT_EQ(scores, Scores{
+		Score{ "item4", 1, 1 },
+		Score{ "item3", 0, 2 },
+		Score{ "item1", 1, 0 },
+		Score{ "item2", 1, 0 },
+		});
+}
 auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(zeroItemsAndVotes);
 	RUN_TEST_IF_ARGUMENT_EQUALS(zeroVotes);
@@ -286,6 +298,7 @@ auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(votingForOptionAButNotFullRound);
 	RUN_TEST_IF_ARGUMENT_EQUALS(votingForOptionBButNotFullRound);
 	RUN_TEST_IF_ARGUMENT_EQUALS(tooFewVotesToScoreAllItems);
+	RUN_TEST_IF_ARGUMENT_EQUALS(scoresAreInOrderOfFirstAppearance);
 	return true;
 }
 
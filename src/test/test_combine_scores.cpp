@@ -1,7 +1,9 @@
+#include <cmath>
 #include <filesystem>
 #include <fstream>
 
 #include "helpers.h"
+#include "mocks/log_catcher.h"
 #include "testing.h"
 #include "score_helpers.h"
 
@@ -49,6 +51,28 @@ void combiningTwoScoreSetsWithDifferentItems() {
 	ASSERT_EQ(combined_scores[0], score1);
 	ASSERT_EQ(combined_scores[1], score2);
 }
+void combiningManyScoreSetsInOrderOfFirstAppearance() {
+	std::vector<Scores> score_sets{};
+	for (uint32_t i = 0; i < 100; i++) {
+		score_sets.push_back({ { "item" + std::to_string(i % 7), 1, 2 }, { "item" + std::to_string((i + 3) % 5), 3, 0 } });
+	}
+	Scores const combined_scores = combineScores(score_sets);
+	ASSERT_EQ(combined_scores, Scores{
+		{ "item0", 75, 30 },
+		{ "item3", 74, 28 },
+		{ "item1", 75, 30 },
+		{ "item4", 74, 28 },
+		{ "item2", 74, 28 },
+		{ "item5", 14, 28 },
+		{ "item6", 14, 28 } });
+}
+void combinerAddsScoresInPlace() {
+	ScoreCombiner combiner{};
+	combiner.add(Score{ "item1", 1, 2 });
+	combiner.add(Scores{ { "item2", 3, 4 }, { "item1", 5, 6 } });
+	combiner.add(Score{ "item2", 7, 8 });
+	ASSERT_EQ(combiner.scores(), Scores{ { "item1", 6, 8 }, { "item2", 10, 12 } });
+}
 void endToEnd_combineFromTwoFiles() {
 	constexpr char const* kScoresFile1 = "scores_1.txt";
 	constexpr char const* kScoresFile2 = "scores_2.txt";
@@ -170,6 +194,54 @@ void endToEnd_combineFromOneEmptyFile() {
 	std::filesystem::remove(kScoresFile2);
 	std::filesystem::remove(kCombinedFile);
 }
+void endToEnd_combineFromManyFilesReportsInInputOrder() {
+	constexpr uint32_t kNumberOfFiles = 20;
+	constexpr char const* kCombinedFile = "many_combined_scores.txt";
+	std::vector<std::string> file_names{};
+	std::string file_names_line{};
+	for (uint32_t i = 0; i < kNumberOfFiles; i++) {
+		file_names.emplace_back("many_scores_" + std::to_string(i + 1) + ".txt");
+		file_names_line += file_names.back() + ' ';
+		ASSERT_TRUE(saveScores({ { "item" + std::to_string(i % 3), i, 1 }, { "item" + std::to_string(i), 1, i } }, file_names.back()));
+	}
+	std::ofstream invalid_file(file_names[4], std::ios::app);
+	invalid_file << "invalid_line\n";
+	invalid_file.close();
+
+	LogCatcher log_catcher{};
+	ASSERT_TRUE(combine(file_names_line, kCombinedFile));
+	log_catcher.stop();
+
+	// Each file is reported in the order given, followed by the errors from parsing it
+	auto const& logs = log_catcher.output();
+	size_t previous_offset = 0;
+	for (auto const& file_name : file_names) {
+		size_t const offset = logs.find("Reading " + file_name + "\n");
+		ASSERT_TRUE(offset != std::string::npos);
+		ASSERT_TRUE(offset >= previous_offset);
+		previous_offset = offset;
+	}
+	size_t const error_offset = logs.find("Invalid score format: invalid_line");
+	ASSERT_TRUE(error_offset > logs.find("Reading " + file_names[4] + "\n"));
+	ASSERT_TRUE(error_offset < logs.find("Reading " + file_names[5] + "\n"));
+
+	Scores expected_scores{};
+	for (uint32_t i = 0; i < kNumberOfFiles; i++) {
+		expected_scores.push_back({ "item" + std::to_string(i % 3), i, 1 });
+		expected_scores.push_back({ "item" + std::to_string(i), 1, i });
+	}
+	ASSERT_EQ(parseScores(loadFile(kCombinedFile)), sortScores(combineScores({ expected_scores })));
+
+	for (auto const& file_name : file_names) {
+		std::filesystem::remove(file_name);
+	}
+	std::filesystem::remove(kCombinedFile);
+}
+void combiningStrengthsWeightedByVotes() {
+	Scores const combined_scores = combineScores({ { { "item1", 1, 0, 2.0 } }, { { "item1", 2, 1, 4.0 }, { "item2", 0, 1 } } });
+	ASSERT_TRUE(std::abs(combined_scores[0].strength.value() - std::pow(2.0, 1.75)) < 1e-9);
+	ASSERT_FALSE(combined_scores[1].strength.has_value());
+}
 
 auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(combiningNoScoreSet);
@@ -179,12 +251,16 @@ auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(combiningTwoScoreSetsWhenOneScoreSetIsEmpty);
 	RUN_TEST_IF_ARGUMENT_EQUALS(combiningTwoScoreSetsWithSameItem);
 	RUN_TEST_IF_ARGUMENT_EQUALS(combiningTwoScoreSetsWithDifferentItems);
+	RUN_TEST_IF_ARGUMENT_EQUALS(combiningManyScoreSetsInOrderOfFirstAppearance);
+	RUN_TEST_IF_ARGUMENT_EQUALS(combinerAddsScoresInPlace);
 	RUN_TEST_IF_ARGUMENT_EQUALS(endToEnd_combineFromTwoFiles);
 	RUN_TEST_IF_ARGUMENT_EQUALS(endToEnd_combineFromThreeFiles);
 	RUN_TEST_IF_ARGUMENT_EQUALS(endToEnd_combineFromTooFewFiles);
 	RUN_TEST_IF_ARGUMENT_EQUALS(endToEnd_combineFromInvalidFileName);
 	RUN_TEST_IF_ARGUMENT_EQUALS(endToEnd_combineFromAllEmptyFiles);
 	RUN_TEST_IF_ARGUMENT_EQUALS(endToEnd_combineFromOneEmptyFile);
+	RUN_TEST_IF_ARGUMENT_EQUALS(endToEnd_combineFromManyFilesReportsInInputOrder);
+	RUN_TEST_IF_ARGUMENT_EQUALS(combiningStrengthsWeightedByVotes);
 	return true;
 }
 
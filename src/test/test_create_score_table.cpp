@@ -115,6 +115,30 @@ void longItemNameAndWinsAndLosses() {
 // TODO: Add more sorting tests for corner cases:
 // - Same item name
 // - TBD
+void strengthIsShownWhenEveryItemHasOne() {
+	Scores const scores{
+		{ "item1", 1, 1, 0.5 },
+		{ "item2", 1, 1, 2.25 } };
+	ASSERT_EQ(createScoreTable(scores), std::string{
+		"------------------------------------\n"
+		"|  Item | Wins | Losses | Strength |\n"
+		"|-------|------|--------|----------|\n"
+		"| item2 |    1 |      1 |    2.250 |\n"
+		"| item1 |    1 |      1 |    0.500 |\n"
+		"------------------------------------\n" });
+}
+void strengthRanksAboveNetWins() {
+	Scores const scores{
+		{ "item1", 3, 0, 0.9 },
+		{ "item2", 1, 2, 1.1 } };
+	ASSERT_EQ(sortScores(scores), Scores{ { "item2", 1, 2 }, { "item1", 3, 0 } });
+}
+void netWinsRankWhenNotEveryItemHasStrength() {
+	Scores const scores{
+		{ "item1", 1, 2, 1.1 },
+		{ "item2", 3, 0 } };
+	ASSERT_EQ(sortScores(scores), Scores{ { "item2", 3, 0 }, { "item1", 1, 2 } });
+}
 
 auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(noScores);
@@ -126,6 +150,9 @@ auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(winLossDifferenceIsEqualAndNegative);
 	RUN_TEST_IF_ARGUMENT_EQUALS(shortItemNameAndWinsAndLosses);
 	RUN_TEST_IF_ARGUMENT_EQUALS(longItemNameAndWinsAndLosses);
+	RUN_TEST_IF_ARGUMENT_EQUALS(strengthIsShownWhenEveryItemHasOne);
+	RUN_TEST_IF_ARGUMENT_EQUALS(strengthRanksAboveNetWins);
+	RUN_TEST_IF_ARGUMENT_EQUALS(netWinsRankWhenNotEveryItemHasStrength);
 	return true;
 }
 
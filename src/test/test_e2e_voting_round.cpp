@@ -86,7 +86,7 @@ void scoresAreTheSameDespiteDifferentItemOrderAndSeed() {
 	}
 
 	auto const seed_1 = voting_round.value().seed();
-	auto items_1 = voting_round.value().items();
+	auto items_1 = voting_round.value().items().toItems();
 	auto scores_1 = calculateScores(items_1, voting_round.value().votes());
 
 	// Reset voting round
@@ -108,7 +108,7 @@ void scoresAreTheSameDespiteDifferentItemOrderAndSeed() {
 	}
 
 	auto const seed_2 = voting_round.value().seed();
-	auto items_2 = voting_round.value().items();
+	auto items_2 = voting_round.value().items().toItems();
 	auto scores_2 = calculateScores(items_2, voting_round.value().votes());
 
 	// Items are the same, but in a different order
@@ -4,10 +4,12 @@
 #include <fstream>
 #include <string>
 #include <queue>
+#include <vector>
 
 #include "helpers.h"
 #include "mocks/log_catcher.h"
 #include "program_loop.h"
+#include "voting_round.h"
 
 extern std::queue<char> g_keys;
 extern std::queue<std::string> g_lines;
@@ -278,7 +280,7 @@ void newVotingRoundSelectFormatLegendNotReprinted() {
 	appendLine(kTestItemsFile);
 	// Repeat an invalid key
 	for (uint32_t i = 0; i < 10; i++) {
-		appendAction(KeyAction::VoteA);
+		appendAction(KeyAction::VoteB);
 	}
 	appendAction(KeyAction::Cancel);
 	appendAction(KeyAction::Quit);
@@ -1254,6 +1256,47 @@ void combineSaveScoresSuccessful() {
 
 	cleanUpFiles(file_names);
 }
+void stateTimerCalledForEachState() {
+	appendAction(KeyAction::NewRound);
+	appendLine(std::string{ static_cast<char>(KeyAction::Cancel) });
+	appendAction(KeyAction::Quit);
+
+	std::vector<std::string> states{};
+	LogCatcher log_catcher{};
+	programLoop([&](std::string_view const state, std::chrono::nanoseconds const elapsed) {
+		ASSERT_TRUE(elapsed.count() >= 0);
+		states.emplace_back(state);
+		});
+	log_catcher.stop();
+
+	ASSERT_TRUE(allActionsCompleted());
+	ASSERT_EQ(states, std::vector<std::string>({ "main_menu", "select_items_file", "main_menu", "quit" }));
+}
+void votingQuitWithoutSavingAfterSaveKeepsSavedVotes() {
+	createItemsFile(4);
+
+	appendAction(KeyAction::NewRound);
+	appendLine(kTestItemsFile);
+	appendAction(KeyAction::FullRound);
+	appendAction(KeyAction::VoteA);
+	appendAction(KeyAction::Save);
+	appendLine(kTestVotesFile);
+	appendLine(std::string{ static_cast<char>(KeyAction::Cancel) });
+	appendAction(KeyAction::VoteB);
+	appendAction(KeyAction::Undo);
+	appendAction(KeyAction::VoteB);
+	appendAction(KeyAction::Quit);
+	appendAction(KeyAction::No);
+	appendAction(KeyAction::Quit);
+
+	programLoop();
+
+	auto const voting_round = VotingRound::create(loadFile(kTestVotesFile));
+	ASSERT_TRUE(voting_round.has_value());
+	ASSERT_EQ(voting_round.value().votes().size(), 1ui64);
+	ASSERT_FALSE(std::filesystem::exists(std::string{ kTestVotesFile } + std::string{ kJournalFileSuffix }));
+	cleanUpFiles();
+}
 
 auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(mainMenuLegendPrinted);
@@ -1331,6 +1374,8 @@ auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(combineSaveScoresEmptyFileName);
 	RUN_TEST_IF_ARGUMENT_EQUALS(combineSaveScoresCancel);
 	RUN_TEST_IF_ARGUMENT_EQUALS(combineSaveScoresSuccessful);
+	RUN_TEST_IF_ARGUMENT_EQUALS(stateTimerCalledForEachState);
+	RUN_TEST_IF_ARGUMENT_EQUALS(votingQuitWithoutSavingAfterSaveKeepsSavedVotes);
 	return true;
 }
 
@@ -68,26 +68,26 @@ void generateWithFullVotingGivesCorrectScheduledVotes() {
 	// NOTE: Scheduled votes are an implementation detail. To determine whether the matchups were
 	// generated as expected, complete the voting and check the matchups afterwards.
 
-	auto const generate_and_get_votes = [](uint32_t number_of_items) -> Votes {
+	auto const generate_and_get_votes = [](uint32_t number_of_items) -> VoteLog {
 		auto voting_round = VotingRound::create(getNItems(number_of_items), VotingFormat::Full);
 		while (voting_round.value().vote(Option::A));
 		return voting_round.value().votes();
 	};
 
-	ASSERT_EQ(generate_and_get_votes(2), Votes{
+	ASSERT_EQ(generate_and_get_votes(2), VoteLog{
 		Vote{0, 1, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(3), Votes{
+	ASSERT_EQ(generate_and_get_votes(3), VoteLog{
 		Vote{0, 1, Option::A},
 		Vote{0, 2, Option::A},
 		Vote{1, 2, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(4), Votes{
+	ASSERT_EQ(generate_and_get_votes(4), VoteLog{
 		Vote{0, 1, Option::A},
 		Vote{0, 2, Option::A},
 		Vote{0, 3, Option::A},
 		Vote{1, 2, Option::A},
 		Vote{1, 3, Option::A},
 		Vote{2, 3, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(5), Votes{
+	ASSERT_EQ(generate_and_get_votes(5), VoteLog{
 		Vote{0, 1, Option::A},
 		Vote{0, 2, Option::A},
 		Vote{0, 3, Option::A},
@@ -98,7 +98,7 @@ void generateWithFullVotingGivesCorrectScheduledVotes() {
 		Vote{2, 3, Option::A},
 		Vote{2, 4, Option::A},
 		Vote{3, 4, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(6), Votes{
+	ASSERT_EQ(generate_and_get_votes(6), VoteLog{
 		Vote{0, 1, Option::A},
 		Vote{0, 2, Option::A},
 		Vote{0, 3, Option::A},
@@ -114,7 +114,7 @@ void generateWithFullVotingGivesCorrectScheduledVotes() {
 		Vote{3, 4, Option::A},
 		Vote{3, 5, Option::A},
 		Vote{4, 5, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(7), Votes{
+	ASSERT_EQ(generate_and_get_votes(7), VoteLog{
 		Vote{0, 1, Option::A},
 		Vote{0, 2, Option::A},
 		Vote{0, 3, Option::A},
@@ -136,7 +136,7 @@ void generateWithFullVotingGivesCorrectScheduledVotes() {
 		Vote{4, 5, Option::A},
 		Vote{4, 6, Option::A},
 		Vote{5, 6, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(8), Votes{
+	ASSERT_EQ(generate_and_get_votes(8), VoteLog{
 		Vote{0, 1, Option::A},
 		Vote{0, 2, Option::A},
 		Vote{0, 3, Option::A},
@@ -165,7 +165,7 @@ void generateWithFullVotingGivesCorrectScheduledVotes() {
 		Vote{5, 6, Option::A},
 		Vote{5, 7, Option::A},
 		Vote{6, 7, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(9), Votes{
+	ASSERT_EQ(generate_and_get_votes(9), VoteLog{
 		Vote{0, 1, Option::A},
 		Vote{0, 2, Option::A},
 		Vote{0, 3, Option::A},
@@ -202,7 +202,7 @@ void generateWithFullVotingGivesCorrectScheduledVotes() {
 		Vote{6, 7, Option::A},
 		Vote{6, 8, Option::A},
 		Vote{7, 8, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(10), Votes{
+	ASSERT_EQ(generate_and_get_votes(10), VoteLog{
 		Vote{0, 1, Option::A},
 		Vote{0, 2, Option::A},
 		Vote{0, 3, Option::A},
@@ -248,7 +248,7 @@ void generateWithFullVotingGivesCorrectScheduledVotes() {
 		Vote{7, 8, Option::A},
 		Vote{7, 9, Option::A},
 		Vote{8, 9, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(11), Votes{
+	ASSERT_EQ(generate_and_get_votes(11), VoteLog{
 		Vote{0, 1, Option::A},
 		Vote{0, 2, Option::A},
 		Vote{0, 3, Option::A},
@@ -304,7 +304,7 @@ void generateWithFullVotingGivesCorrectScheduledVotes() {
 		Vote{8, 9, Option::A},
 		Vote{8, 10, Option::A},
 		Vote{9, 10, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(12), Votes{
+	ASSERT_EQ(generate_and_get_votes(12), VoteLog{
 		Vote{0, 1, Option::A},
 		Vote{0, 2, Option::A},
 		Vote{0, 3, Option::A},
@@ -372,6 +372,15 @@ void generateWithFullVotingGivesCorrectScheduledVotes() {
 		Vote{9, 11, Option::A},
 		Vote{10, 11, Option::A} });
 }
+void generateWithTooManyItemsToPairUpOnlyLimitsFullVoting() {
+	// Full voting would schedule more than 2^32 pairs, while reduced voting schedules a few per item
+	constexpr uint32_t kNumberOfItems = 100'000;
+	auto const items = getNItems(kNumberOfItems);
+	ASSERT_FALSE(VotingRound::create(items, VotingFormat::Full).has_value());
+	auto const voting_round = VotingRound::create(items, VotingFormat::Reduced);
+	ASSERT_TRUE(voting_round.has_value());
+	ASSERT_EQ(voting_round.value().numberOfScheduledVotes(), kNumberOfItems * 3 / 2);
+}
 
 auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(generateWithTooFewItems);
@@ -383,6 +392,7 @@ auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(generateWithFullVotingGivesCorrectAmountOfScheduledVotes);
 	RUN_TEST_IF_ARGUMENT_EQUALS(generateWithReducedVotingGivesCorrectAmountOfScheduledVotes);
 	RUN_TEST_IF_ARGUMENT_EQUALS(generateWithFullVotingGivesCorrectScheduledVotes);
+	RUN_TEST_IF_ARGUMENT_EQUALS(generateWithTooManyItemsToPairUpOnlyLimitsFullVoting);
 	return true;
 }
 
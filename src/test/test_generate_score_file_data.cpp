@@ -23,12 +23,27 @@ void multipleScores() {
 			"71 4 item2"
 	});
 }
+void scoresWithStrengths() {
+	ASSERT_EQ(generateScoreFileData({ Score{ "item1", 3, 6, 0.25 }, Score{ "item2", 71, 4, 12.5 } }), std::vector<std::string>{
+		"Strength Wins Losses Item",
+		"0.250 3 6 item1",
+		"12.500 71 4 item2"
+	});
+}
+void strengthsAreNotSavedUnlessEveryScoreHasOne() {
+	ASSERT_EQ(generateScoreFileData({ Score{ "item1", 3, 6, 0.25 }, Score{ "item2", 71, 4 } }), std::vector<std::string>{
+		"3 6 item1",
+		"71 4 item2"
+	});
+}
 
 auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(noScores);
 	RUN_TEST_IF_ARGUMENT_EQUALS(oneScore);
 	RUN_TEST_IF_ARGUMENT_EQUALS(oneScoreWithSpacesInItemName);
 	RUN_TEST_IF_ARGUMENT_EQUALS(multipleScores);
+	RUN_TEST_IF_ARGUMENT_EQUALS(scoresWithStrengths);
+	RUN_TEST_IF_ARGUMENT_EQUALS(strengthsAreNotSavedUnlessEveryScoreHasOne);
 	return true;
 }
 
@@ -88,7 +88,7 @@ void scoresAreCalculatedWithCorrectItems() {
 	for (uint32_t i = 0; i < voting_round.value().numberOfScheduledVotes(); i++) {
 		voting_round.value().vote(Option::A);
 	}
-	auto const scores = calculateScores(voting_round.value().items(), voting_round.value().votes());
+	auto const scores = calculateScores(voting_round.value().items().toItems(), voting_round.value().votes());
 
 	// Because of the order in which matchups are generated, voting for A each time
 	// will mean the first item gets N-1 wins, where N is the number of items.
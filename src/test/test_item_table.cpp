@@ -0,0 +1,56 @@
+#include "item_table.h"
+#include "testing.h"
+
+namespace
+{
+
+void emptyTable() {
+	ItemTable const item_table{};
+	ASSERT_TRUE(item_table.empty());
+	ASSERT_EQ(item_table.size(), 0ui32);
+	ASSERT_FALSE(item_table.find("item1").has_value());
+}
+void internedItemsGetDenseIds() {
+	ItemTable item_table{};
+	ASSERT_EQ(item_table.intern("item1"), 0ui32);
+	ASSERT_EQ(item_table.intern("item2"), 1ui32);
+	ASSERT_EQ(item_table.intern("item3"), 2ui32);
+	ASSERT_EQ(item_table.size(), 3ui32);
+}
+void internedItemIsStoredOnce() {
+	ItemTable item_table{};
+	ASSERT_EQ(item_table.intern("item1"), 0ui32);
+	ASSERT_EQ(item_table.intern("item2"), 1ui32);
+	ASSERT_EQ(item_table.intern("item1"), 0ui32);
+	ASSERT_EQ(item_table.size(), 2ui32);
+	ASSERT_EQ(item_table.names(), Items{ "item1", "item2" });
+}
+void findInternedItem() {
+	ItemTable const item_table{ getNItems(5) };
+	ASSERT_EQ(item_table.find("item4").value(), 3ui32);
+	ASSERT_FALSE(item_table.find("item6").has_value());
+}
+void nameOfInternedItem() {
+	ItemTable const item_table{ getNItems(5) };
+	for (ItemId id = 0; id < item_table.size(); id++) {
+		ASSERT_EQ(item_table.name(id), "item" + std::to_string(id + 1));
+	}
+}
+
+auto run_tests(std::string const& test) -> bool {
+	RUN_TEST_IF_ARGUMENT_EQUALS(emptyTable);
+	RUN_TEST_IF_ARGUMENT_EQUALS(internedItemsGetDenseIds);
+	RUN_TEST_IF_ARGUMENT_EQUALS(internedItemIsStoredOnce);
+	RUN_TEST_IF_ARGUMENT_EQUALS(findInternedItem);
+	RUN_TEST_IF_ARGUMENT_EQUALS(nameOfInternedItem);
+	return true;
+}
+
+} // namespace
+
+auto test_item_table(std::string const& test_case) -> int {
+	if (run_tests(test_case)) {
+		return 1;
+	}
+	return 0;
+}
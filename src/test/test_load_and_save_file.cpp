@@ -2,6 +2,7 @@
 #include <fstream>
 
 #include "helpers.h"
+#include "mapped_file.h"
 #include "testing.h"
 
 namespace
@@ -75,6 +76,40 @@ void loadingNonExistingFile() {
 	ASSERT_FALSE(std::filesystem::exists(kTestFileName));
 	ASSERT_TRUE(loadFile(kTestFileName).empty());
 }
+void mappingLinesWithoutTrailingNewline() {
+	std::ofstream file(kTestFileName, std::ios::binary);
+	file << "List\nof\n\nlines";
+	file.close();
+	auto const mapped_file = MappedFile::open(kTestFileName);
+	ASSERT_TRUE(mapped_file.has_value());
+	ASSERT_EQ(mapped_file.value().lines(), Lines{ "List", "of", "", "lines" });
+}
+void mappingLinesWithCarriageReturns() {
+	std::ofstream file(kTestFileName, std::ios::binary);
+	file << "List\r\nof\r\n\r\nlines\r\n";
+	file.close();
+	auto const mapped_file = MappedFile::open(kTestFileName);
+	ASSERT_TRUE(mapped_file.has_value());
+	ASSERT_EQ(mapped_file.value().lines(), Lines{ "List", "of", "", "lines" });
+}
+void mappingEmptyFile() {
+	std::ofstream file(kTestFileName);
+	file.close();
+	auto const mapped_file = MappedFile::open(kTestFileName);
+	ASSERT_TRUE(mapped_file.has_value());
+	ASSERT_TRUE(mapped_file.value().lines().empty());
+}
+void mappingNonExistingFile() {
+	ASSERT_FALSE(MappedFile::open(kTestFileName).has_value());
+}
+void mappedFileIsMovable() {
+	ASSERT_TRUE(saveFile(kTestFileName, { "List", "of", "lines" }));
+	auto mapped_file = MappedFile::open(kTestFileName);
+	ASSERT_TRUE(mapped_file.has_value());
+	MappedFile const moved_file = std::move(mapped_file.value());
+	ASSERT_TRUE(mapped_file.value().lines().empty());
+	ASSERT_EQ(moved_file.lines(), Lines{ "List", "of", "lines" });
+}
 
 auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(savingAndLoadingLines);
@@ -84,6 +119,11 @@ auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(loadingNoLines);
 	RUN_TEST_IF_ARGUMENT_EQUALS(savingToExistingFile);
 	RUN_TEST_IF_ARGUMENT_EQUALS(loadingNonExistingFile);
+	RUN_TEST_IF_ARGUMENT_EQUALS(mappingLinesWithoutTrailingNewline);
+	RUN_TEST_IF_ARGUMENT_EQUALS(mappingLinesWithCarriageReturns);
+	RUN_TEST_IF_ARGUMENT_EQUALS(mappingEmptyFile);
+	RUN_TEST_IF_ARGUMENT_EQUALS(mappingNonExistingFile);
+	RUN_TEST_IF_ARGUMENT_EQUALS(mappedFileIsMovable);
 	return true;
 }
 
@@ -0,0 +1,84 @@
+#include <vector>
+
+#include "matchup_bitmap.h"
+#include "testing.h"
+
+namespace
+{
+
+/* -------------- Test helpers -------------- */
+auto allMatchups(uint32_t const number_of_items) -> IndexPairs {
+	IndexPairs matchups{};
+	for (Index a = 0; a < number_of_items; a++) {
+		for (Index b = a + 1; b < number_of_items; b++) {
+			matchups.emplace_back(a, b);
+		}
+	}
+	return matchups;
+}
+
+/* -------------- Tests -------------- */
+void everyMatchupHasItsOwnBit() {
+	constexpr uint32_t kNumberOfItems = 50;
+	std::vector<bool> used_bits(kNumberOfItems * (kNumberOfItems - 1) / 2, false);
+	for (auto const& matchup : allMatchups(kNumberOfItems)) {
+		uint64_t const bit = MatchupBitmap::bitIndex(matchup);
+		ASSERT_TRUE(bit < used_bits.size());
+		ASSERT_FALSE(used_bits[bit]);
+		used_bits[bit] = true;
+	}
+}
+void matchupsAreTheSameInEitherOrder() {
+	MatchupBitmap bitmap{ 10 };
+	ASSERT_FALSE(bitmap.isSet({ 7, 2 }));
+	ASSERT_TRUE(bitmap.set({ 7, 2 }));
+	ASSERT_TRUE(bitmap.isSet({ 2, 7 }));
+	ASSERT_FALSE(bitmap.set({ 2, 7 }));
+	ASSERT_FALSE(bitmap.isSet({ 2, 8 }));
+}
+void sizeCoversEveryMatchup() {
+	ASSERT_EQ(MatchupBitmap::sizeInBytes(0), 0ull);
+	ASSERT_EQ(MatchupBitmap::sizeInBytes(1), 0ull);
+	ASSERT_EQ(MatchupBitmap::sizeInBytes(2), 1ull);
+	ASSERT_EQ(MatchupBitmap::sizeInBytes(5), 2ull);
+	ASSERT_EQ(MatchupBitmap::sizeInBytes(100'000), 624'993'750ull);
+}
+void duplicateMatchupsAreFoundInVotes() {
+	VoteLog votes{ { 0, 1, Option::A }, { 2, 3, Option::B }, { 1, 0, Option::B } };
+	ASSERT_TRUE(hasDuplicateMatchups(4, votes));
+	votes.popBack();
+	ASSERT_FALSE(hasDuplicateMatchups(4, votes));
+}
+void duplicateMatchupsAreFoundInIndexPairs() {
+	auto matchups = allMatchups(100);
+	ASSERT_FALSE(hasDuplicateMatchups(100, matchups));
+	matchups.emplace_back(99, 42);
+	ASSERT_TRUE(hasDuplicateMatchups(100, matchups));
+}
+void duplicateMatchupsAreFoundWithoutBitmap() {
+	// A bitmap for this many items would take gigabytes, so few matchups are sorted instead
+	constexpr uint32_t kNumberOfItems = 4'000'000'000;
+	IndexPairs matchups{ { 0, kNumberOfItems - 1 }, { 12345, 67890 }, { kNumberOfItems - 2, kNumberOfItems - 1 } };
+	ASSERT_FALSE(hasDuplicateMatchups(kNumberOfItems, matchups));
+	matchups.emplace_back(kNumberOfItems - 1, 0);
+	ASSERT_TRUE(hasDuplicateMatchups(kNumberOfItems, matchups));
+}
+
+auto run_tests(std::string const& test) -> bool {
+	RUN_TEST_IF_ARGUMENT_EQUALS(everyMatchupHasItsOwnBit);
+	RUN_TEST_IF_ARGUMENT_EQUALS(matchupsAreTheSameInEitherOrder);
+	RUN_TEST_IF_ARGUMENT_EQUALS(sizeCoversEveryMatchup);
+	RUN_TEST_IF_ARGUMENT_EQUALS(duplicateMatchupsAreFoundInVotes);
+	RUN_TEST_IF_ARGUMENT_EQUALS(duplicateMatchupsAreFoundInIndexPairs);
+	RUN_TEST_IF_ARGUMENT_EQUALS(duplicateMatchupsAreFoundWithoutBitmap);
+	return true;
+}
+
+} // namespace
+
+auto test_matchup_bitmap(std::string const& test_case) -> int {
+	if (run_tests(test_case)) {
+		return 1;
+	}
+	return 0;
+}
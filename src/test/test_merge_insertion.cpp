@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <random>
+
+#include "merge_insertion.h"
+#include "testing.h"
+#include "voting_round.h"
+
+namespace
+{
+
+/* -------------- Test helpers -------------- */
+auto itemNumber(Item const& item) -> int {
+	// Sort by number, since lexicographical comparison would sort like this: item1 < item10 < item2
+	return std::stoi(item.substr(4));
+}
+auto voteBySorting(VotingRound& voting_round) -> uint32_t {
+	uint32_t number_of_votes = 0;
+	while (voting_round.hasRemainingVotes()) {
+		auto const matchup = voting_round.currentMatchup();
+		voting_round.vote(itemNumber(matchup.value().item_a) < itemNumber(matchup.value().item_b) ? Option::A : Option::B);
+		number_of_votes++;
+	}
+	return number_of_votes;
+}
+
+/* -------------- Tests -------------- */
+void maximumNumberOfVotes() {
+	std::vector<uint32_t> const expected_votes{ 0, 0, 1, 3, 5, 7, 10, 13, 16, 19, 22, 26, 30, 34, 38, 42, 46 };
+	for (uint32_t number_of_items = 0; number_of_items < expected_votes.size(); number_of_items++) {
+		ASSERT_EQ(MergeInsertion::maximumNumberOfVotes(number_of_items), expected_votes[number_of_items]);
+	}
+}
+void rankItemsBySorting() {
+	for (uint32_t number_of_items = 2; number_of_items < 40; number_of_items++) {
+		auto const sorted_items = getNItems(number_of_items);
+		auto voting_round = VotingRound::create(sorted_items, VotingFormat::MergeInsertion, 12345 + number_of_items);
+		voting_round.value().shuffle();
+
+		uint32_t const number_of_votes = voteBySorting(voting_round.value());
+		ASSERT_TRUE(number_of_votes <= MergeInsertion::maximumNumberOfVotes(number_of_items));
+		ASSERT_EQ(voting_round.value().items(), sorted_items);
+		ASSERT_EQ(voting_round.value().numberOfSortedItems(), number_of_items);
+	}
+}
+void rankItemsInAnyOrder() {
+	std::default_random_engine engine(12345);
+	for (uint32_t number_of_items = 2; number_of_items < 25; number_of_items++) {
+		auto voting_round = VotingRound::create(getNItems(number_of_items), VotingFormat::MergeInsertion);
+		while (voting_round.value().vote(engine() % 2 == 0 ? Option::A : Option::B));
+		ASSERT_TRUE(voting_round.value().votes().size() <= MergeInsertion::maximumNumberOfVotes(number_of_items));
+
+		// Even inconsistent votes result in a ranking of all items
+		auto const items = voting_round.value().items().toItems();
+		ASSERT_EQ(voting_round.value().items().size(), static_cast<size_t>(number_of_items));
+		auto sorted_items = items;
+		std::sort(sorted_items.begin(), sorted_items.end());
+		auto expected_items = getNItems(number_of_items);
+		std::sort(expected_items.begin(), expected_items.end());
+		ASSERT_EQ(sorted_items, expected_items);
+	}
+}
+void undoVotesDisplaysPreviousMatchups() {
+	auto voting_round = VotingRound::create(getNItems(20), VotingFormat::MergeInsertion, 12345);
+	voting_round.value().shuffle();
+	std::vector<std::string> voting_lines{};
+	while (voting_round.value().hasRemainingVotes()) {
+		voting_lines.push_back(voting_round.value().currentVotingLine().value());
+		auto const matchup = voting_round.value().currentMatchup();
+		voting_round.value().vote(itemNumber(matchup.value().item_a) < itemNumber(matchup.value().item_b) ? Option::A : Option::B);
+	}
+	while (!voting_lines.empty()) {
+		ASSERT_TRUE(voting_round.value().undoVote());
+		ASSERT_EQ(voting_round.value().currentVotingLine().value(), voting_lines.back());
+		voting_lines.pop_back();
+	}
+	ASSERT_FALSE(voting_round.value().undoVote());
+	ASSERT_EQ(voting_round.value().numberOfSortedItems(), 0u);
+}
+void savingAndLoadingMergeInsertionRound() {
+	auto voting_round = VotingRound::create(getNItems(30), VotingFormat::MergeInsertion, 12345);
+	voting_round.value().shuffle();
+	for (uint32_t i = 0; i < 40; i++) {
+		voting_round.value().vote(i % 3 == 0 ? Option::B : Option::A);
+	}
+
+	auto const lines = voting_round.value().convertToText();
+	ASSERT_EQ(lines[32], std::string{ "merge" });
+	auto loaded_voting_round = VotingRound::create(lines);
+	ASSERT_TRUE(loaded_voting_round.has_value());
+	ASSERT_EQ(loaded_voting_round.value().format(), VotingFormat::MergeInsertion);
+	ASSERT_EQ(loaded_voting_round.value().currentVotingLine(), voting_round.value().currentVotingLine());
+
+	auto binary_voting_round = VotingRound::createFromBinary(voting_round.value().convertToBinary());
+	ASSERT_TRUE(binary_voting_round.has_value());
+	ASSERT_EQ(binary_voting_round.value().currentVotingLine(), voting_round.value().currentVotingLine());
+
+	voteBySorting(voting_round.value());
+	voteBySorting(loaded_voting_round.value());
+	ASSERT_EQ(loaded_voting_round.value().items(), voting_round.value().items());
+}
+void loadingVotesNotMatchingMatchups() {
+	auto voting_round = VotingRound::create(getNItems(8), VotingFormat::MergeInsertion, 12345);
+	voting_round.value().shuffle();
+	voting_round.value().vote(Option::A);
+	voting_round.value().vote(Option::A);
+
+	// Swap the indices of the last vote
+	auto lines = voting_round.value().convertToText();
+	Vote const vote = voting_round.value().votes().back();
+	lines.back() = voteRecord(Vote{ vote.b_idx, vote.a_idx, vote.winner });
+	ASSERT_FALSE(VotingRound::create(lines).has_value());
+}
+void loadingTooManyVotes() {
+	auto voting_round = VotingRound::create(getNItems(2), VotingFormat::MergeInsertion, 12345);
+	voting_round.value().vote(Option::A);
+	ASSERT_FALSE(voting_round.value().hasRemainingVotes());
+	ASSERT_FALSE(VotingRound::create(voting_round.value().convertToText() + std::string{ "0 1 0" }).has_value());
+}
+void undoingVotesMatchesLoadingTheRemainingVotes() {
+	std::default_random_engine engine(12345);
+	for (uint32_t number_of_items = 2; number_of_items < 40; number_of_items++) {
+		auto voting_round = VotingRound::create(getNItems(number_of_items), VotingFormat::MergeInsertion, 12345 + number_of_items);
+		voting_round.value().shuffle();
+		while (voting_round.value().hasRemainingVotes()) {
+			voting_round.value().vote(engine() % 2 == 0 ? Option::A : Option::B);
+			if (engine() % 3 == 0) {
+				ASSERT_TRUE(voting_round.value().undoVote());
+			}
+			auto const loaded_voting_round = VotingRound::create(voting_round.value().convertToText());
+			ASSERT_TRUE(loaded_voting_round.has_value());
+			ASSERT_EQ(loaded_voting_round.value().currentVotingLine(), voting_round.value().currentVotingLine());
+		}
+		auto const loaded_voting_round = VotingRound::create(voting_round.value().convertToText());
+		ASSERT_EQ(loaded_voting_round.value().items(), voting_round.value().items());
+	}
+}
+void voteCounterAndMaximumTotalVotesIsPresented() {
+	auto voting_round = VotingRound::create(getNItems(10), VotingFormat::MergeInsertion, 12345);
+	ASSERT_EQ(MergeInsertion::maximumNumberOfVotes(10), 22u);
+	ASSERT_EQ(voting_round.value().currentVotingLine().value().substr(0, 7), std::string{ "( 1/22)" });
+	voting_round.value().vote(Option::A);
+	ASSERT_EQ(voting_round.value().currentVotingLine().value().substr(0, 7), std::string{ "( 2/22)" });
+}
+
+auto run_tests(std::string const& test) -> bool {
+	RUN_TEST_IF_ARGUMENT_EQUALS(maximumNumberOfVotes);
+	RUN_TEST_IF_ARGUMENT_EQUALS(rankItemsBySorting);
+	RUN_TEST_IF_ARGUMENT_EQUALS(rankItemsInAnyOrder);
+	RUN_TEST_IF_ARGUMENT_EQUALS(undoVotesDisplaysPreviousMatchups);
+	RUN_TEST_IF_ARGUMENT_EQUALS(savingAndLoadingMergeInsertionRound);
+	RUN_TEST_IF_ARGUMENT_EQUALS(loadingVotesNotMatchingMatchups);
+	RUN_TEST_IF_ARGUMENT_EQUALS(loadingTooManyVotes);
+	RUN_TEST_IF_ARGUMENT_EQUALS(undoingVotesMatchesLoadingTheRemainingVotes);
+	RUN_TEST_IF_ARGUMENT_EQUALS(voteCounterAndMaximumTotalVotesIsPresented);
+	return true;
+}
+
+} // namespace
+
+auto test_merge_insertion(std::string const& test_case) -> int {
+	if (run_tests(test_case)) {
+		return 1;
+	}
+	return 0;
+}
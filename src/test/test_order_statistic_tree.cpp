@@ -0,0 +1,96 @@
+#include <random>
+
+#include "order_statistic_tree.h"
+#include "testing.h"
+#include "voting_round.h"
+
+namespace
+{
+
+void emptyTree() {
+	OrderStatisticTree const tree{};
+	ASSERT_EQ(tree.size(), 0u);
+	ASSERT_TRUE(tree.toVector().empty());
+}
+void insertingAtEnd() {
+	OrderStatisticTree tree{};
+	for (Index i = 0; i < 100; i++) {
+		tree.insert(i, i);
+	}
+	ASSERT_EQ(tree.size(), 100u);
+	for (Index i = 0; i < 100; i++) {
+		ASSERT_EQ(tree.at(i), i);
+	}
+}
+void insertingAtFront() {
+	OrderStatisticTree tree{};
+	for (Index i = 0; i < 100; i++) {
+		tree.insert(0, i);
+	}
+	for (Index i = 0; i < 100; i++) {
+		ASSERT_EQ(tree.at(i), 99 - i);
+	}
+}
+void insertingAndErasingMatchesVector() {
+	std::default_random_engine engine(12345);
+	OrderStatisticTree tree{};
+	std::vector<Index> values{};
+	for (Index i = 0; i < 2000; i++) {
+		if (!values.empty() && engine() % 3 == 0) {
+			auto const position = static_cast<uint32_t>(engine() % values.size());
+			ASSERT_EQ(tree.erase(position), values[position]);
+			values.erase(values.begin() + position);
+		}
+		else {
+			auto const position = static_cast<uint32_t>(engine() % (values.size() + 1));
+			tree.insert(position, i);
+			values.insert(values.begin() + position, i);
+		}
+		ASSERT_EQ(tree.size(), static_cast<uint32_t>(values.size()));
+	}
+	ASSERT_EQ(tree.toVector(), values);
+	for (uint32_t position = 0; position < values.size(); position++) {
+		ASSERT_EQ(tree.at(position), values[position]);
+	}
+}
+void clearingTree() {
+	OrderStatisticTree tree{};
+	tree.insert(0, 1);
+	tree.insert(1, 2);
+	tree.clear();
+	ASSERT_EQ(tree.size(), 0u);
+	tree.insert(0, 3);
+	ASSERT_EQ(tree.toVector(), std::vector<Index>{ 3 });
+}
+void reloadingManyRankedItems() {
+	constexpr uint32_t kNumberOfItems = 20'000;
+	auto voting_round = VotingRound::create(getNItems(kNumberOfItems), VotingFormat::Ranked, 12345);
+	voting_round.value().shuffle();
+	std::default_random_engine engine(54321);
+	while (voting_round.value().vote(engine() % 2 == 0 ? Option::A : Option::B));
+	ASSERT_EQ(voting_round.value().numberOfSortedItems(), kNumberOfItems);
+
+	auto const loaded_voting_round = VotingRound::create(voting_round.value().convertToText());
+	ASSERT_TRUE(loaded_voting_round.has_value());
+	ASSERT_EQ(loaded_voting_round.value().numberOfSortedItems(), kNumberOfItems);
+	ASSERT_EQ(loaded_voting_round.value().items(), voting_round.value().items());
+}
+
+auto run_tests(std::string const& test) -> bool {
+	RUN_TEST_IF_ARGUMENT_EQUALS(emptyTree);
+	RUN_TEST_IF_ARGUMENT_EQUALS(insertingAtEnd);
+	RUN_TEST_IF_ARGUMENT_EQUALS(insertingAtFront);
+	RUN_TEST_IF_ARGUMENT_EQUALS(insertingAndErasingMatchesVector);
+	RUN_TEST_IF_ARGUMENT_EQUALS(clearingTree);
+	RUN_TEST_IF_ARGUMENT_EQUALS(reloadingManyRankedItems);
+	return true;
+}
+
+} // namespace
+
+auto test_order_statistic_tree(std::string const& test_case) -> int {
+	if (run_tests(test_case)) {
+		return 1;
+	}
+	return 0;
+}
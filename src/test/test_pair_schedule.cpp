@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <random>
+#include <unordered_set>
+
+#include "constants.h"
+#include "helpers.h"
+#include "pair_schedule.h"
+#include "testing.h"
+#include "voting_round.h"
+
+namespace
+{
+
+/* -------------- Test helpers -------------- */
+auto scheduledPairs(PairSchedule const& pair_schedule) -> IndexPairs {
+	IndexPairs index_pairs{};
+	for (uint64_t i = 0; i < pair_schedule.size(); i++) {
+		index_pairs.push_back(pair_schedule.indexPair(i));
+	}
+	return index_pairs;
+}
+auto allPairs(uint32_t const number_of_items) -> IndexPairs {
+	IndexPairs index_pairs{};
+	for (uint32_t a = 0; a < number_of_items; a++) {
+		for (uint32_t b = a + 1; b < number_of_items; b++) {
+			index_pairs.emplace_back(a, b);
+		}
+	}
+	return index_pairs;
+}
+
+/* -------------- Tests -------------- */
+void fewerThanTwoItems() {
+	ASSERT_FALSE(PairSchedule::create(0).has_value());
+	ASSERT_FALSE(PairSchedule::create(1).has_value());
+	ASSERT_TRUE(PairSchedule::create(2).has_value());
+}
+void unshuffledScheduleIsInOrder() {
+	for (uint32_t number_of_items = 2; number_of_items < 40; number_of_items++) {
+		auto const pair_schedule = PairSchedule::create(number_of_items);
+		ASSERT_EQ(pair_schedule.value().size(), static_cast<uint64_t>(sumOfFirstIntegers(number_of_items - 1)));
+		ASSERT_EQ(scheduledPairs(pair_schedule.value()), allPairs(number_of_items));
+	}
+}
+void shuffledScheduleContainsEveryPairOnce() {
+	for (uint32_t number_of_items = 2; number_of_items < 80; number_of_items++) {
+		auto pair_schedule = PairSchedule::create(number_of_items);
+		pair_schedule.value().shuffle(number_of_items * 7919);
+		IndexPairs index_pairs = scheduledPairs(pair_schedule.value());
+		std::sort(index_pairs.begin(), index_pairs.end());
+		ASSERT_EQ(index_pairs, allPairs(number_of_items));
+	}
+}
+void shufflingIsDeterministic() {
+	auto first_schedule = PairSchedule::create(30);
+	auto second_schedule = PairSchedule::create(30);
+	first_schedule.value().shuffle(123456);
+	second_schedule.value().shuffle(123456);
+	ASSERT_EQ(scheduledPairs(first_schedule.value()), scheduledPairs(second_schedule.value()));
+
+	second_schedule.value().shuffle(654321);
+	ASSERT_NE(scheduledPairs(first_schedule.value()), scheduledPairs(second_schedule.value()));
+	ASSERT_NE(scheduledPairs(first_schedule.value()), allPairs(30));
+}
+void positionOutOfRange() {
+	auto const pair_schedule = PairSchedule::create(5);
+	ASSERT_EQ(pair_schedule.value().indexPair(10), IndexPair{});
+	ASSERT_EQ(pair_schedule.value().indexPair(1000), IndexPair{});
+}
+void unrankingManyItems() {
+	constexpr uint32_t kNumberOfItems = 90'000;
+	auto const pair_schedule = PairSchedule::create(kNumberOfItems);
+	uint64_t const number_of_pairs = pair_schedule.value().size();
+	ASSERT_EQ(pair_schedule.value().indexPair(0), IndexPair{ 0, 1 });
+	ASSERT_EQ(pair_schedule.value().indexPair(kNumberOfItems - 2), IndexPair{ 0, kNumberOfItems - 1 });
+	ASSERT_EQ(pair_schedule.value().indexPair(kNumberOfItems - 1), IndexPair{ 1, 2 });
+	ASSERT_EQ(pair_schedule.value().indexPair(number_of_pairs - 2), IndexPair{ kNumberOfItems - 3, kNumberOfItems - 1 });
+	ASSERT_EQ(pair_schedule.value().indexPair(number_of_pairs - 1), IndexPair{ kNumberOfItems - 2, kNumberOfItems - 1 });
+}
+void largeFullVotingRoundSchedulesPairsOnDemand() {
+	constexpr uint32_t kNumberOfItems = 1'500;
+	ASSERT_TRUE(sumOfFirstIntegers(kNumberOfItems - 1) > kMaxMaterializedIndexPairs);
+
+	auto voting_round = VotingRound::create(getNItems(kNumberOfItems), VotingFormat::Full, 12345);
+	ASSERT_TRUE(voting_round.has_value());
+	voting_round.value().shuffle();
+	ASSERT_EQ(voting_round.value().numberOfScheduledVotes(), static_cast<uint32_t>(sumOfFirstIntegers(kNumberOfItems - 1)));
+
+	std::unordered_set<IndexPair, IndexPairHash> voted_pairs{};
+	for (uint32_t i = 0; i < 10'000; i++) {
+		ASSERT_TRUE(voting_round.value().vote(i % 2 == 0 ? Option::A : Option::B));
+		auto const& vote = voting_round.value().votes().back();
+		ASSERT_TRUE(vote.a_idx < vote.b_idx);
+		ASSERT_TRUE(voted_pairs.insert({ vote.a_idx, vote.b_idx }).second);
+	}
+
+	// Resuming the voting round continues the same schedule
+	ASSERT_EQ(voting_round.value().pairOrder(), PairOrder::Permuted);
+	for (auto const& loaded_voting_round : {
+		VotingRound::create(voting_round.value().convertToText()),
+		VotingRound::createFromBinary(voting_round.value().convertToBinary()) }) {
+		ASSERT_TRUE(loaded_voting_round.has_value());
+		ASSERT_EQ(loaded_voting_round.value().pairOrder(), PairOrder::Permuted);
+		ASSERT_EQ(loaded_voting_round.value().currentVotingLine(), voting_round.value().currentVotingLine());
+	}
+}
+void resumingLargeFullRoundSavedWithoutPairOrder() {
+	// Saved before permuted rounds existed, so its pairs are every pair in a seeded shuffle
+	constexpr uint32_t kNumberOfItems = 1'500;
+	constexpr Seed kSeed = 12345;
+	constexpr uint32_t kNumberOfSavedVotes = 1'000;
+	auto shuffled_pairs = allPairs(kNumberOfItems);
+	std::default_random_engine engine(kSeed);
+	std::shuffle(shuffled_pairs.begin(), shuffled_pairs.end(), engine);
+
+	std::vector<std::string> lines = getNItems(kNumberOfItems);
+	lines.emplace_back("");
+	lines.emplace_back(std::to_string(kSeed));
+	lines.emplace_back("full");
+	for (uint32_t i = 0; i < kNumberOfSavedVotes; i++) {
+		lines.emplace_back(std::to_string(shuffled_pairs[i].first) + " " + std::to_string(shuffled_pairs[i].second) + " 0");
+	}
+
+	auto voting_round = VotingRound::create(lines);
+	ASSERT_TRUE(voting_round.has_value());
+	ASSERT_EQ(voting_round.value().pairOrder(), PairOrder::Shuffled);
+	for (uint32_t i = kNumberOfSavedVotes; i < 2 * kNumberOfSavedVotes; i++) {
+		ASSERT_TRUE(voting_round.value().vote(Option::B));
+		auto const& vote = voting_round.value().votes().back();
+		ASSERT_EQ(IndexPair{ vote.a_idx, vote.b_idx }, shuffled_pairs[i]);
+	}
+
+	// Saved again without the mark, and still loadable
+	auto const saved_lines = voting_round.value().convertToText();
+	ASSERT_EQ(saved_lines[kNumberOfItems + 3], lines[kNumberOfItems + 3]);
+	auto const loaded_voting_round = VotingRound::create(saved_lines);
+	ASSERT_TRUE(loaded_voting_round.has_value());
+	ASSERT_EQ(loaded_voting_round.value().votes(), voting_round.value().votes());
+}
+
+auto run_tests(std::string const& test) -> bool {
+	RUN_TEST_IF_ARGUMENT_EQUALS(fewerThanTwoItems);
+	RUN_TEST_IF_ARGUMENT_EQUALS(unshuffledScheduleIsInOrder);
+	RUN_TEST_IF_ARGUMENT_EQUALS(shuffledScheduleContainsEveryPairOnce);
+	RUN_TEST_IF_ARGUMENT_EQUALS(shufflingIsDeterministic);
+	RUN_TEST_IF_ARGUMENT_EQUALS(positionOutOfRange);
+	RUN_TEST_IF_ARGUMENT_EQUALS(unrankingManyItems);
+	RUN_TEST_IF_ARGUMENT_EQUALS(largeFullVotingRoundSchedulesPairsOnDemand);
+	RUN_TEST_IF_ARGUMENT_EQUALS(resumingLargeFullRoundSavedWithoutPairOrder);
+	return true;
+}
+
+} // namespace
+
+auto test_pair_schedule(std::string const& test_case) -> int {
+	if (run_tests(test_case)) {
+		return 1;
+	}
+	return 0;
+}
@@ -96,6 +96,25 @@ void nonNumbers() {
 	ASSERT_EQ(Scores{}, parseScores({ "0 @ item1" }));
 	// Could exhaust more, but it's likely unnecessary
 }
+void numbersOutOfRange() {
+	ASSERT_EQ(parseScores({ "4294967295 0 item1" }), Scores{ Score{ "item1", 4294967295, 0 } });
+	ASSERT_EQ(Scores{}, parseScores({ "4294967296 0 item1" }));
+	ASSERT_EQ(Scores{}, parseScores({ "0 99999999999999999999 item1" }));
+}
+void stringsWithStrengths() {
+	auto const scores = parseScores({ "Strength Wins Losses Item", "0.250 3 6 item 1", "12.500 71 4 item2" });
+	ASSERT_EQ(scores, (Scores{ { "item 1", 3, 6 }, { "item2", 71, 4 } }));
+	ASSERT_EQ(scores[0].strength, std::optional<double>{ 0.25 });
+	ASSERT_EQ(scores[1].strength, std::optional<double>{ 12.5 });
+}
+void stringsWithInvalidStrengths() {
+	ASSERT_EQ(parseScores({ "Strength Wins Losses Item", "abc 3 6 item" }), Scores{});
+	ASSERT_EQ(parseScores({ "Strength Wins Losses Item", "-1.0 3 6 item" }), Scores{});
+	ASSERT_EQ(parseScores({ "Strength Wins Losses Item", "3 6 item" }), Scores{});
+}
+void strengthsWithoutHeaderAreItemNames() {
+	ASSERT_EQ(parseScores({ "3 6 0.250 item" }), Scores{ { "0.250 item", 3, 6 } });
+}
 
 auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(stringIsEmpty);
@@ -113,6 +132,10 @@ auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(onlyOneStringIsValid);
 	RUN_TEST_IF_ARGUMENT_EQUALS(validNumbers);
 	RUN_TEST_IF_ARGUMENT_EQUALS(nonNumbers);
+	RUN_TEST_IF_ARGUMENT_EQUALS(numbersOutOfRange);
+	RUN_TEST_IF_ARGUMENT_EQUALS(stringsWithStrengths);
+	RUN_TEST_IF_ARGUMENT_EQUALS(stringsWithInvalidStrengths);
+	RUN_TEST_IF_ARGUMENT_EQUALS(strengthsWithoutHeaderAreItemNames);
 	return true;
 }
 
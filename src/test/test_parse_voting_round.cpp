@@ -296,7 +296,7 @@ void chosenVoteIsNotZeroOrOne() {
 }
 
 // Combined tests
-auto hasItem(Items const& items, Item const& item) -> bool {
+auto hasItem(ItemsView const& items, Item const& item) -> bool {
 	return std::find(items.begin(), items.end(), item) != items.end();
 }
 void fourItemsAndReducedVotingAndFourVotes() {
@@ -321,7 +321,7 @@ void fourItemsAndReducedVotingAndFourVotes() {
 	ASSERT_EQ(voting_round.value().seed(), 12345678ui32);
 	ASSERT_EQ(voting_round.value().format(), VotingFormat::Reduced);
 	ASSERT_EQ(voting_round.value().numberOfScheduledVotes(), 6ui32);
-	ASSERT_EQ(voting_round.value().votes(), Votes{
+	ASSERT_EQ(voting_round.value().votes(), VoteLog{
 		Vote{1, 3, Option::A},
 		Vote{0, 1, Option::B},
 		Vote{2, 3, Option::A},
@@ -355,7 +355,7 @@ void sevenItemsAndReducedVotingAndFourVotes() {
 	ASSERT_EQ(voting_round.value().seed(), 12345678ui32);
 	ASSERT_EQ(voting_round.value().format(), VotingFormat::Reduced);
 	ASSERT_EQ(voting_round.value().numberOfScheduledVotes(), 14ui32);
-	ASSERT_EQ(voting_round.value().votes(), Votes{
+	ASSERT_EQ(voting_round.value().votes(), VoteLog{
 		Vote{1, 3, Option::A},
 		Vote{0, 1, Option::B},
 		Vote{2, 3, Option::A},
@@ -380,7 +380,7 @@ void fourItemsAndFullVotingAndOneVote() {
 	ASSERT_EQ(voting_round.value().seed(), 12345678ui32);
 	ASSERT_EQ(voting_round.value().format(), VotingFormat::Full);
 	ASSERT_EQ(voting_round.value().numberOfScheduledVotes(), 6ui32);
-	ASSERT_EQ(voting_round.value().votes(), Votes{ Vote{1, 3, Option::A} });
+	ASSERT_EQ(voting_round.value().votes(), VoteLog{ Vote{1, 3, Option::A} });
 }
 void fourItemsAndFullVotingAndZeroVotes() {
 	std::optional<VotingRound> voting_round = VotingRound::create({
@@ -402,6 +402,17 @@ void fourItemsAndFullVotingAndZeroVotes() {
 	ASSERT_EQ(voting_round.value().numberOfScheduledVotes(), 6ui32);
 	ASSERT_TRUE(voting_round.value().votes().empty());
 }
+void voteIndexIsTooLargeForAVote() {
+	// Index B would be item2's index if its top bit was dropped
+	ASSERT_FALSE(VotingRound::create({
+		"item1",
+		"item2",
+		"item3",
+		"",
+		"1",
+		"full",
+		"0 2147483649 0" }).has_value());
+}
 
 auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(noLinesToParse);
@@ -429,6 +440,7 @@ auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(sevenItemsAndReducedVotingAndFourVotes);
 	RUN_TEST_IF_ARGUMENT_EQUALS(fourItemsAndFullVotingAndOneVote);
 	RUN_TEST_IF_ARGUMENT_EQUALS(fourItemsAndFullVotingAndZeroVotes);
+	RUN_TEST_IF_ARGUMENT_EQUALS(voteIndexIsTooLargeForAVote);
 	return true;
 }
 
@@ -0,0 +1,129 @@
+#include <array>
+#include <filesystem>
+#include <string>
+
+#include "calculate_scores.h"
+#include "helpers.h"
+#include "profiler.h"
+#include "score_helpers.h"
+#include "testing.h"
+
+namespace
+{
+
+constexpr auto kProfileFile = "test_profile.json";
+constexpr std::array<char const*, 2> kScoreFiles{ "test_profile_scores1.txt", "test_profile_scores2.txt" };
+constexpr auto kCombinedFile = "test_profile_combined.txt";
+
+/* -------------- Test helpers -------------- */
+auto stopProfilingAndReadProfile() -> std::string {
+	ASSERT_TRUE(stopProfiling());
+	std::string profile{};
+	for (auto const& line : loadFile(kProfileFile)) {
+		profile += line + "\n";
+	}
+	std::filesystem::remove(kProfileFile);
+	return profile;
+}
+auto occurrences(std::string const& str, std::string const& substr) -> size_t {
+	size_t count = 0;
+	for (size_t offset = str.find(substr); offset != std::string::npos; offset = str.find(substr, offset + substr.size())) {
+		count++;
+	}
+	return count;
+}
+
+/* -------------- Tests -------------- */
+void nothingIsRecordedWhenNotProfiling() {
+	ASSERT_FALSE(isProfiling());
+	{
+		ScopedTimer const timer{ "timer" };
+		addToCounter("counter");
+	}
+	ASSERT_FALSE(stopProfiling());
+	ASSERT_FALSE(std::filesystem::exists(kProfileFile));
+}
+void summaryTotalsTimersAndCounters() {
+	startProfiling(kProfileFile, ProfileFormat::Summary);
+	ASSERT_TRUE(isProfiling());
+	for (int i = 0; i < 3; i++) {
+		ScopedTimer const timer{ "timer" };
+	}
+	addToCounter("counter", 5);
+	addToCounter("counter");
+
+	auto const profile = stopProfilingAndReadProfile();
+	ASSERT_FALSE(isProfiling());
+	ASSERT_TRUE(profile.find("\"timer\": { \"count\": 3, \"total_ms\": ") != std::string::npos);
+	ASSERT_TRUE(profile.find("\"counter\": 6") != std::string::npos);
+}
+void traceHasEventPerTimerAndCounterUpdate() {
+	startProfiling(kProfileFile, ProfileFormat::Trace);
+	for (int i = 0; i < 3; i++) {
+		ScopedTimer const timer{ "timer" };
+	}
+	addToCounter("counter", 5);
+	addToCounter("counter");
+
+	auto const profile = stopProfilingAndReadProfile();
+	ASSERT_TRUE(profile.starts_with("{\"traceEvents\":["));
+	ASSERT_EQ(occurrences(profile, "{\"name\":\"timer\""), 3u);
+	ASSERT_EQ(occurrences(profile, "\"ph\":\"X\""), 3u);
+	ASSERT_EQ(occurrences(profile, "\"ph\":\"C\""), 2u);
+	ASSERT_TRUE(profile.find("\"args\":{\"value\":6}") != std::string::npos);
+}
+void timersOnEveryThreadAreRecorded() {
+	startProfiling(kProfileFile, ProfileFormat::Summary);
+	runInParallel(16, [](size_t) {
+		ScopedTimer const timer{ "timer" };
+		addToCounter("counter");
+		});
+
+	auto const profile = stopProfilingAndReadProfile();
+	ASSERT_TRUE(profile.find("\"timer\": { \"count\": 16,") != std::string::npos);
+	ASSERT_TRUE(profile.find("\"counter\": 16") != std::string::npos);
+}
+void calculatingScoresIsProfiled() {
+	startProfiling(kProfileFile, ProfileFormat::Summary);
+	calculateScores({ "item1", "item2" }, { Vote{ 0, 1, Option::A }, Vote{ 0, 1, Option::B } });
+
+	auto const profile = stopProfilingAndReadProfile();
+	ASSERT_TRUE(profile.find("\"calculateScores\": { \"count\": 1,") != std::string::npos);
+	ASSERT_TRUE(profile.find("\"votes_counted\": 2") != std::string::npos);
+}
+void combiningScoreFilesIsProfiled() {
+	std::vector<std::string> file_names{};
+	for (auto const file_name : kScoreFiles) {
+		ASSERT_TRUE(saveFile(file_name, generateScoreFileData({ Score{ "item1", 1, 0 }, Score{ "item2", 0, 1 } })));
+		file_names.emplace_back(file_name);
+	}
+	startProfiling(kProfileFile, ProfileFormat::Summary);
+	ASSERT_TRUE(combine(file_names, kCombinedFile));
+
+	auto const profile = stopProfilingAndReadProfile();
+	ASSERT_TRUE(profile.find("\"ScoreCombiner::add\": { \"count\": 2,") != std::string::npos);
+	ASSERT_TRUE(profile.find("\"ScoreCombiner::scores\": { \"count\": 1,") != std::string::npos);
+	for (auto const file_name : kScoreFiles) {
+		std::filesystem::remove(file_name);
+	}
+	std::filesystem::remove(kCombinedFile);
+}
+
+auto run_tests(std::string const& test) -> bool {
+	RUN_TEST_IF_ARGUMENT_EQUALS(nothingIsRecordedWhenNotProfiling);
+	RUN_TEST_IF_ARGUMENT_EQUALS(summaryTotalsTimersAndCounters);
+	RUN_TEST_IF_ARGUMENT_EQUALS(traceHasEventPerTimerAndCounterUpdate);
+	RUN_TEST_IF_ARGUMENT_EQUALS(timersOnEveryThreadAreRecorded);
+	RUN_TEST_IF_ARGUMENT_EQUALS(calculatingScoresIsProfiled);
+	RUN_TEST_IF_ARGUMENT_EQUALS(combiningScoreFilesIsProfiled);
+	return true;
+}
+
+} // namespace
+
+auto test_profiler(std::string const& test_case) -> int {
+	if (run_tests(test_case)) {
+		return 1;
+	}
+	return 0;
+}
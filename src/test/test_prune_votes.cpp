@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "constants.h"
 #include "helpers.h"
 #include "testing.h"
@@ -34,26 +36,26 @@ void pruningRemovesCorrectScheduledVotes() {
 	// NOTE: Scheduled votes are an implementation detail. To determine whether the matchups were
 	// generated as expected, complete the voting and check the matchups afterwards.
 
-	auto const generate_and_get_votes = [](uint32_t number_of_items) -> Votes {
+	auto const generate_and_get_votes = [](uint32_t number_of_items) -> VoteLog {
 		auto voting_round = VotingRound::create(getNItems(number_of_items), VotingFormat::Reduced);
 		while (voting_round.value().vote(Option::A));
 		return voting_round.value().votes();
 	};
 
-	ASSERT_EQ(generate_and_get_votes(2), Votes{
+	ASSERT_EQ(generate_and_get_votes(2), VoteLog{
 		Vote{0, 1, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(3), Votes{
+	ASSERT_EQ(generate_and_get_votes(3), VoteLog{
 		Vote{0, 1, Option::A},
 		Vote{0, 2, Option::A},
 		Vote{1, 2, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(4), Votes{
+	ASSERT_EQ(generate_and_get_votes(4), VoteLog{
 		Vote{0, 1, Option::A},
 		Vote{0, 2, Option::A},
 		Vote{0, 3, Option::A},
 		Vote{1, 2, Option::A},
 		Vote{1, 3, Option::A},
 		Vote{2, 3, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(5), Votes{
+	ASSERT_EQ(generate_and_get_votes(5), VoteLog{
 		Vote{0, 1, Option::A},
 		Vote{0, 2, Option::A},
 		Vote{0, 3, Option::A},
@@ -64,7 +66,7 @@ void pruningRemovesCorrectScheduledVotes() {
 		Vote{2, 3, Option::A},
 		Vote{2, 4, Option::A},
 		Vote{3, 4, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(6), Votes{
+	ASSERT_EQ(generate_and_get_votes(6), VoteLog{
 		Vote{0, 2, Option::A},
 		Vote{0, 3, Option::A},
 		Vote{0, 4, Option::A},
@@ -74,7 +76,7 @@ void pruningRemovesCorrectScheduledVotes() {
 		Vote{2, 4, Option::A},
 		Vote{2, 5, Option::A},
 		Vote{3, 5, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(7), Votes{
+	ASSERT_EQ(generate_and_get_votes(7), VoteLog{
 		Vote{0, 2, Option::A},
 		Vote{0, 3, Option::A},
 		Vote{0, 4, Option::A},
@@ -89,7 +91,7 @@ void pruningRemovesCorrectScheduledVotes() {
 		Vote{3, 5, Option::A},
 		Vote{3, 6, Option::A},
 		Vote{4, 6, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(8), Votes{
+	ASSERT_EQ(generate_and_get_votes(8), VoteLog{
 		Vote{0, 3, Option::A},
 		Vote{0, 4, Option::A},
 		Vote{0, 5, Option::A},
@@ -102,7 +104,7 @@ void pruningRemovesCorrectScheduledVotes() {
 		Vote{3, 6, Option::A},
 		Vote{3, 7, Option::A},
 		Vote{4, 7, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(9), Votes{
+	ASSERT_EQ(generate_and_get_votes(9), VoteLog{
 		Vote{0, 3, Option::A},
 		Vote{0, 4, Option::A},
 		Vote{0, 5, Option::A},
@@ -121,7 +123,7 @@ void pruningRemovesCorrectScheduledVotes() {
 		Vote{4, 7, Option::A},
 		Vote{4, 8, Option::A},
 		Vote{5, 8, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(10), Votes{
+	ASSERT_EQ(generate_and_get_votes(10), VoteLog{
 		Vote{0, 4, Option::A},
 		Vote{0, 5, Option::A},
 		Vote{0, 6, Option::A},
@@ -137,7 +139,7 @@ void pruningRemovesCorrectScheduledVotes() {
 		Vote{4, 8, Option::A},
 		Vote{4, 9, Option::A},
 		Vote{5, 9, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(11), Votes{
+	ASSERT_EQ(generate_and_get_votes(11), VoteLog{
 		Vote{0, 4, Option::A},
 		Vote{0, 5, Option::A},
 		Vote{0, 6, Option::A},
@@ -160,7 +162,7 @@ void pruningRemovesCorrectScheduledVotes() {
 		Vote{5, 9, Option::A},
 		Vote{5, 10, Option::A},
 		Vote{6, 10, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(12), Votes{
+	ASSERT_EQ(generate_and_get_votes(12), VoteLog{
 		Vote{0, 5, Option::A},
 		Vote{0, 6, Option::A},
 		Vote{0, 7, Option::A},
@@ -179,7 +181,7 @@ void pruningRemovesCorrectScheduledVotes() {
 		Vote{5, 10, Option::A},
 		Vote{5, 11, Option::A},
 		Vote{6, 11, Option::A} });
-	ASSERT_EQ(generate_and_get_votes(13), Votes{
+	ASSERT_EQ(generate_and_get_votes(13), VoteLog{
 		Vote{0, 5, Option::A},
 		Vote{0, 6, Option::A},
 		Vote{0, 7, Option::A},
@@ -208,11 +210,39 @@ void pruningRemovesCorrectScheduledVotes() {
 		Vote{7, 12, Option::A} });
 }
 
+void pruningMatchesRemovingPairsWithinPruningDistance() {
+	for (uint32_t number_of_items = kMinimumItemsForPruning; number_of_items < 60; number_of_items++) {
+		// Remove all pairs whose distance, wrapping around the items, is within the pruning amount
+		uint32_t const pruning = pruningAmount(number_of_items);
+		VoteLog expected_votes{};
+		for (uint32_t a = 0; a < number_of_items; a++) {
+			for (uint32_t b = a + 1; b < number_of_items; b++) {
+				uint32_t const distance = std::min(b - a, number_of_items - (b - a));
+				if (distance > pruning) {
+					expected_votes.append(Vote{ a, b, Option::A });
+				}
+			}
+		}
+
+		auto voting_round = VotingRound::create(getNItems(number_of_items), VotingFormat::Reduced);
+		while (voting_round.value().vote(Option::A));
+		ASSERT_EQ(voting_round.value().votes(), expected_votes);
+	}
+}
+void pruningManyItems() {
+	constexpr uint32_t kNumberOfItems = 20'001;
+	auto const voting_round = VotingRound::create(getNItems(kNumberOfItems), VotingFormat::Reduced);
+	ASSERT_TRUE(voting_round.has_value());
+	ASSERT_EQ(voting_round.value().numberOfScheduledVotes(), 2 * kNumberOfItems);
+}
+
 auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(pruningDuringVotingRoundCreationWithTooFewItems);
 	RUN_TEST_IF_ARGUMENT_EQUALS(pruningAmountDuringVotingRoundCreationDependsOnNumberOfItems);
 	RUN_TEST_IF_ARGUMENT_EQUALS(parseVotingRoundWithPruning);
 	RUN_TEST_IF_ARGUMENT_EQUALS(pruningRemovesCorrectScheduledVotes);
+	RUN_TEST_IF_ARGUMENT_EQUALS(pruningMatchesRemovingPairsWithinPruningDistance);
+	RUN_TEST_IF_ARGUMENT_EQUALS(pruningManyItems);
 	return true;
 }
 
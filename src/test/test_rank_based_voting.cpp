@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "helpers.h"
 #include "menus.h"
 #include "testing.h"
@@ -8,18 +10,20 @@ namespace
 
 // TODO: Move to another test file - probably make a new test
 void newRoundFormatStringPresentsAvailableVotingFormatsAndNumberOfVotes() {
-	auto const expected_string = [](uint32_t full_votes, uint32_t reduced_votes, uint32_t ranked_votes) -> std::string {
+	auto const expected_string = [](uint32_t full_votes, uint32_t reduced_votes, uint32_t ranked_votes, uint32_t merge_votes, uint32_t adaptive_votes) -> std::string {
 		return
 			"Please choose voting format:\n"
 			"[F]ull     score-based voting - " + std::to_string(full_votes) + " votes\n"
 			"[R]educed  score-based voting - " + std::to_string(reduced_votes) + " votes\n"
 			"[I]nsertion rank-based voting - Around " + std::to_string(ranked_votes) + " votes\n"
+			"[M]erge     rank-based voting - At most " + std::to_string(merge_votes) + " votes\n"
+			"[A]daptive  rank-based voting - Around " + std::to_string(adaptive_votes) + " votes\n"
 			"[C]ancel";
 	};
-	ASSERT_EQ(newRoundFormatString(2), expected_string(1, 1, 2));
-	ASSERT_EQ(newRoundFormatString(5), expected_string(10, 10, 11));
-	ASSERT_EQ(newRoundFormatString(6), expected_string(15, 9, 15));
-	ASSERT_EQ(newRoundFormatString(10), expected_string(45, 15, 33));
+	ASSERT_EQ(newRoundFormatString(2), expected_string(1, 1, 2, 1, 1));
+	ASSERT_EQ(newRoundFormatString(5), expected_string(10, 10, 11, 7, 10));
+	ASSERT_EQ(newRoundFormatString(6), expected_string(15, 9, 15, 10, 15));
+	ASSERT_EQ(newRoundFormatString(10), expected_string(45, 15, 33, 22, 45));
 }
 // TODO: Move to generate_new_voting_round, and combine with other format testing
 void createNewRankedVotingRound() {
@@ -56,7 +60,7 @@ void parseRankedVotingRoundWithSomeVotes() {
 		});
 		ASSERT_TRUE(voting_round.has_value());
 		ASSERT_EQ(voting_round.value().format(), VotingFormat::Ranked);
-		ASSERT_EQ(voting_round.value().votes(), Votes{
+		ASSERT_EQ(voting_round.value().votes(), VoteLog{
 			Vote{ 0, 1, Option::B },
 		});
 	}
@@ -147,6 +151,24 @@ void undoAllRankVotesThenVoteTheSame() {
 	}
 }
 // TODO: Move to test_undo
+void undoRankVotesAfterLoading() {
+	auto voting_round{ VotingRound::create(getNItems(30), VotingFormat::Ranked, 12345) };
+	voting_round.value().shuffle();
+	std::vector<std::string> voting_lines{};
+	for (uint32_t i = 0; i < 60; i++) {
+		voting_lines.push_back(voting_round.value().currentVotingLine().value());
+		voting_round.value().vote(i % 3 == 0 ? Option::B : Option::A);
+	}
+
+	auto loaded_voting_round = VotingRound::create(voting_round.value().convertToText());
+	while (!voting_lines.empty()) {
+		ASSERT_TRUE(loaded_voting_round.value().undoVote());
+		ASSERT_EQ(loaded_voting_round.value().currentVotingLine().value(), voting_lines.back());
+		voting_lines.pop_back();
+	}
+	ASSERT_FALSE(loaded_voting_round.value().undoVote());
+	ASSERT_EQ(loaded_voting_round.value().numberOfSortedItems(), 1u);
+}
 void undoRankVoteDisplaysPreviousOptions() {
 	for (uint32_t number_of_items = 2; number_of_items < 25; number_of_items++) {
 		auto voting_round = VotingRound::create(getNItems(number_of_items), VotingFormat::Ranked);
@@ -266,7 +288,7 @@ void rankItemsBySortingWhenInitiallyUnranked() {
 		voting_round.value().shuffle();
 
 		// Note that this inequality might not be true for all seeds
-		ASSERT_NE(voting_round.value().items(), sorted_items);
+		ASSERT_NE(voting_round.value().items().toItems(), sorted_items);
 
 		while (voting_round.value().hasRemainingVotes()) {
 			auto const matchup = voting_round.value().currentMatchup();
@@ -279,6 +301,20 @@ void rankItemsBySortingWhenInitiallyUnranked() {
 		ASSERT_EQ(voting_round.value().items(), sorted_items);
 	}
 }
+void rankingKeepsOriginalItemOrder() {
+	auto const items = getNItems(20);
+	auto voting_round{ VotingRound::create(items, VotingFormat::Ranked, 12345) };
+	voting_round.value().shuffle();
+	while (voting_round.value().vote(Option::B));
+
+	ASSERT_EQ(voting_round.value().originalItemOrder(), items);
+	auto ranked_items = voting_round.value().items().toItems();
+	ASSERT_NE(ranked_items, items);
+	std::sort(ranked_items.begin(), ranked_items.end());
+	auto sorted_items = items;
+	std::sort(sorted_items.begin(), sorted_items.end());
+	ASSERT_EQ(ranked_items, sorted_items);
+}
 void voteCounterAndApproximateTotalVotesIsPresented() {
 	auto const items = getNItems(10);
 	auto voting_round{ VotingRound::create(items, VotingFormat::Ranked) };
@@ -312,6 +348,17 @@ void voteCounterAndApproximateTotalVotesIsPresented() {
 	ASSERT_EQ(get_counter_string_then_vote_A(), std::string{ "( 18/~33)" });
 	ASSERT_EQ(get_counter_string_then_vote_A(), std::string{ "( 19/~33)" });
 }
+void earlierItemsViewKeepsItsRanking() {
+	auto voting_round{ VotingRound::create(getNItems(10), VotingFormat::Ranked, 12345) };
+	voting_round.value().vote(Option::A);
+	auto const earlier_view = voting_round.value().items();
+	auto const earlier_items = earlier_view.toItems();
+
+	while (voting_round.value().vote(Option::B));
+	auto const later_view = voting_round.value().items();
+	ASSERT_EQ(earlier_view, earlier_items);
+	ASSERT_NE(later_view.toItems(), earlier_items);
+}
 
 auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(newRoundFormatStringPresentsAvailableVotingFormatsAndNumberOfVotes);
@@ -323,6 +370,7 @@ auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(undoFirstRankVoteReducesNumberOfSortedItems);
 	RUN_TEST_IF_ARGUMENT_EQUALS(undoLastRankVoteReducesNumberOfSortedItems);
 	RUN_TEST_IF_ARGUMENT_EQUALS(undoAllRankVotesThenVoteTheSame);
+	RUN_TEST_IF_ARGUMENT_EQUALS(undoRankVotesAfterLoading);
 	RUN_TEST_IF_ARGUMENT_EQUALS(undoRankVoteDisplaysPreviousOptions);
 	RUN_TEST_IF_ARGUMENT_EQUALS(numberOfSortedItemsIncrementsWhenRightOptionChanges);
 	RUN_TEST_IF_ARGUMENT_EQUALS(presentedOptionsDependOnVoting);
@@ -331,7 +379,9 @@ auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(convertingRankedVotingRoundToText);
 	RUN_TEST_IF_ARGUMENT_EQUALS(rankItemsBySortingWhenInitiallyRanked);
 	RUN_TEST_IF_ARGUMENT_EQUALS(rankItemsBySortingWhenInitiallyUnranked);
+	RUN_TEST_IF_ARGUMENT_EQUALS(rankingKeepsOriginalItemOrder);
 	RUN_TEST_IF_ARGUMENT_EQUALS(voteCounterAndApproximateTotalVotesIsPresented);
+	RUN_TEST_IF_ARGUMENT_EQUALS(earlierItemsViewKeepsItsRanking);
 	return true;
 }
 
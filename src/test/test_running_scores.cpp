@@ -0,0 +1,78 @@
+#include "calculate_scores.h"
+#include "score_helpers.h"
+#include "testing.h"
+#include "voting_round.h"
+
+namespace
+{
+
+/* -------------- Test helpers -------------- */
+auto calculatedScores(VotingRound const& voting_round) -> Scores {
+	return sortScores(calculateScores(voting_round.items().toItems(), voting_round.votes()));
+}
+
+/* -------------- Tests -------------- */
+void noScoresBeforeVoting() {
+	auto const voting_round = VotingRound::create(getNItems(5), VotingFormat::Full);
+	ASSERT_TRUE(voting_round.value().scores().empty());
+}
+void runningScoresMatchCalculatedScoresWhileVoting() {
+	auto voting_round = VotingRound::create(getNItems(8), VotingFormat::Full, 12345);
+	voting_round.value().shuffle();
+	bool vote_for_a = true;
+	while (voting_round.value().vote(vote_for_a ? Option::A : Option::B)) {
+		ASSERT_EQ(sortScores(voting_round.value().scores()), calculatedScores(voting_round.value()));
+		vote_for_a = !vote_for_a;
+	}
+}
+void runningScoresMatchCalculatedScoresWhenUndoing() {
+	auto voting_round = VotingRound::create(getNItems(8), VotingFormat::Reduced, 12345);
+	voting_round.value().shuffle();
+	for (uint32_t i = 0; i < 10; i++) {
+		voting_round.value().vote(i % 3 == 0 ? Option::A : Option::B);
+	}
+	while (voting_round.value().undoVote()) {
+		ASSERT_EQ(sortScores(voting_round.value().scores()), calculatedScores(voting_round.value()));
+	}
+	ASSERT_TRUE(voting_round.value().scores().empty());
+}
+void runningScoresMatchCalculatedScoresAfterLoading() {
+	auto voting_round = VotingRound::create(getNItems(8), VotingFormat::Full, 12345);
+	voting_round.value().shuffle();
+	for (uint32_t i = 0; i < 10; i++) {
+		voting_round.value().vote(i % 2 == 0 ? Option::A : Option::B);
+	}
+
+	auto const loaded_voting_round = VotingRound::create(voting_round.value().convertToText());
+	ASSERT_TRUE(loaded_voting_round.has_value());
+	ASSERT_EQ(sortScores(loaded_voting_round.value().scores()), calculatedScores(loaded_voting_round.value()));
+	ASSERT_EQ(sortScores(loaded_voting_round.value().scores()), sortScores(voting_round.value().scores()));
+}
+void runningScoresHaveStrengths() {
+	auto voting_round = VotingRound::create(getNItems(8), VotingFormat::Full, 12345);
+	voting_round.value().shuffle();
+	for (uint32_t i = 0; i < 10; i++) {
+		voting_round.value().vote(i % 2 == 0 ? Option::A : Option::B);
+	}
+	for (auto const& score : voting_round.value().scores()) {
+		ASSERT_TRUE(score.strength.value() > 0.0);
+	}
+}
+
+auto run_tests(std::string const& test) -> bool {
+	RUN_TEST_IF_ARGUMENT_EQUALS(noScoresBeforeVoting);
+	RUN_TEST_IF_ARGUMENT_EQUALS(runningScoresMatchCalculatedScoresWhileVoting);
+	RUN_TEST_IF_ARGUMENT_EQUALS(runningScoresMatchCalculatedScoresWhenUndoing);
+	RUN_TEST_IF_ARGUMENT_EQUALS(runningScoresMatchCalculatedScoresAfterLoading);
+	RUN_TEST_IF_ARGUMENT_EQUALS(runningScoresHaveStrengths);
+	return true;
+}
+
+} // namespace
+
+auto test_running_scores(std::string const& test_case) -> int {
+	if (run_tests(test_case)) {
+		return 1;
+	}
+	return 0;
+}
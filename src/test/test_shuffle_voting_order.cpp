@@ -10,7 +10,7 @@ void shufflingWithSeedIsDeterministic() {
 
 	while (voting_round.value().vote(Option::A));
 
-	ASSERT_EQ(voting_round.value().votes(), Votes{
+	ASSERT_EQ(voting_round.value().votes(), VoteLog{
 		Vote{0, 6, Option::A},
 		Vote{0, 3, Option::A},
 		Vote{6, 7, Option::A},
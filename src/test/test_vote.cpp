@@ -57,6 +57,18 @@ void votingAfterRoundCompleted() {
 	ASSERT_FALSE(voting_round.value().vote(Option::B));
 	ASSERT_EQ(voting_round.value().votes().size(), 3ui64);
 }
+void votesArePackedWithTheWinner() {
+	Vote const vote{ 7, kMaxVoteIndex, Option::B };
+	ASSERT_EQ(sizeof(Vote), 8u);
+	ASSERT_EQ(vote.a_idx, 7u);
+	ASSERT_EQ(vote.b_idx, kMaxVoteIndex);
+	ASSERT_TRUE(vote.winner == Option::B);
+	ASSERT_FALSE(vote == (Vote{ 7, kMaxVoteIndex, Option::A }));
+}
+void voteIndicesAreLimitedToTheirBits() {
+	ASSERT_EQ(toVoteIndex(kMaxVoteIndex), std::optional<Index>{ kMaxVoteIndex });
+	ASSERT_FALSE(toVoteIndex(uint64_t{ kMaxVoteIndex } + 1).has_value());
+}
 
 auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(firstVoteForA);
@@ -64,6 +76,8 @@ auto run_tests(std::string const& test) -> bool {
 	RUN_TEST_IF_ARGUMENT_EQUALS(votingForAForEachScheduledVote);
 	RUN_TEST_IF_ARGUMENT_EQUALS(votingForBForEachScheduledVote);
 	RUN_TEST_IF_ARGUMENT_EQUALS(votingAfterRoundCompleted);
+	RUN_TEST_IF_ARGUMENT_EQUALS(votesArePackedWithTheWinner);
+	RUN_TEST_IF_ARGUMENT_EQUALS(voteIndicesAreLimitedToTheirBits);
 	return true;
 }
 
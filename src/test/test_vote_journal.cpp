@@ -0,0 +1,202 @@
+#include <filesystem>
+#include <fstream>
+
+#include "helpers.h"
+#include "testing.h"
+#include "voting_round.h"
+
+namespace
+{
+
+constexpr char const* kJournalFileName = "test_vote_journal.txt";
+constexpr char const* kCrashedJournalFileName = "test_vote_journal_crashed.txt";
+
+/* -------------- Test helpers -------------- */
+auto createVotingRound(VotingFormat const voting_format) -> VotingRound {
+	auto voting_round = VotingRound::create(getNItems(8), voting_format, 12345);
+	voting_round.value().shuffle();
+	return voting_round.value();
+}
+auto loadJournal() -> std::optional<VotingRound> {
+	return VotingRound::create(loadFile(kJournalFileName));
+}
+auto journalFileName() -> std::string {
+	return kJournalFileName + std::string{ kJournalFileSuffix };
+}
+// Leaves the journal file behind like a crash would, which destroying the voting round removes
+void crashWhileJournaling(VotingRound&& voting_round) {
+	std::filesystem::copy_file(journalFileName(), kCrashedJournalFileName, std::filesystem::copy_options::overwrite_existing);
+	{
+		VotingRound const crashed_voting_round{ std::move(voting_round) };
+	}
+	std::filesystem::rename(kCrashedJournalFileName, journalFileName());
+}
+
+/* -------------- Tests -------------- */
+void journalStartsWithSavedVotingRound() {
+	auto voting_round = createVotingRound(VotingFormat::Full);
+	voting_round.vote(Option::A);
+	ASSERT_TRUE(voting_round.startJournal(kJournalFileName, 1));
+	ASSERT_TRUE(voting_round.isJournaling());
+	ASSERT_TRUE(voting_round.isSaved());
+	ASSERT_EQ(loadFile(kJournalFileName), voting_round.convertToText());
+}
+void journaledVotesAreAppendedWhenSaving() {
+	auto voting_round = createVotingRound(VotingFormat::Full);
+	ASSERT_TRUE(voting_round.startJournal(kJournalFileName, 1));
+	auto const saved_lines = loadFile(kJournalFileName);
+	voting_round.vote(Option::A);
+	voting_round.vote(Option::B);
+	ASSERT_FALSE(voting_round.isSaved());
+	ASSERT_EQ(loadFile(kJournalFileName), saved_lines);
+
+	ASSERT_TRUE(voting_round.save(kJournalFileName));
+	ASSERT_TRUE(voting_round.isSaved());
+	ASSERT_EQ(loadFile(kJournalFileName), voting_round.convertToText());
+	ASSERT_EQ(loadJournal().value().votes(), voting_round.votes());
+}
+void stoppingJournalDiscardsUnsavedVotes() {
+	auto voting_round = createVotingRound(VotingFormat::Full);
+	ASSERT_TRUE(voting_round.startJournal(kJournalFileName, 1));
+	voting_round.vote(Option::A);
+	ASSERT_TRUE(voting_round.save(kJournalFileName));
+	auto const saved_lines = loadFile(kJournalFileName);
+	voting_round.vote(Option::B);
+	ASSERT_TRUE(std::filesystem::exists(kJournalFileName + std::string{ kJournalFileSuffix }));
+
+	voting_round.stopJournal();
+	ASSERT_EQ(loadFile(kJournalFileName), saved_lines);
+	ASSERT_EQ(loadJournal().value().votes().size(), 1ui64);
+	ASSERT_FALSE(std::filesystem::exists(kJournalFileName + std::string{ kJournalFileSuffix }));
+}
+void journaledUndosAreReplayedOnLoad() {
+	auto voting_round = createVotingRound(VotingFormat::Ranked);
+	ASSERT_TRUE(voting_round.startJournal(kJournalFileName, 1));
+	for (uint32_t i = 0; i < 10; i++) {
+		voting_round.vote(i % 2 == 0 ? Option::A : Option::B);
+		if (i % 3 == 0) {
+			voting_round.undoVote();
+		}
+	}
+	ASSERT_TRUE(voting_round.save(kJournalFileName));
+	ASSERT_TRUE(voting_round.isSaved());
+
+	auto const loaded_voting_round = loadJournal();
+	ASSERT_TRUE(loaded_voting_round.has_value());
+	ASSERT_EQ(loaded_voting_round.value().votes(), voting_round.votes());
+	ASSERT_EQ(loaded_voting_round.value().items(), voting_round.items());
+	ASSERT_EQ(loaded_voting_round.value().currentVotingLine(), voting_round.currentVotingLine());
+}
+void journalIsSyncedInBatches() {
+	std::string const journal_file_name = kJournalFileName + std::string{ kJournalFileSuffix };
+	auto voting_round = createVotingRound(VotingFormat::Full);
+	ASSERT_TRUE(voting_round.startJournal(kJournalFileName, 4));
+	for (uint32_t i = 0; i < 3; i++) {
+		voting_round.vote(Option::A);
+	}
+	ASSERT_TRUE(loadFile(journal_file_name).empty());
+	voting_round.vote(Option::A);
+	ASSERT_EQ(loadFile(journal_file_name).size(), 4ui64);
+}
+void savingToAnotherFileKeepsJournal() {
+	constexpr char const* kOtherFileName = "test_vote_journal_other.txt";
+	auto voting_round = createVotingRound(VotingFormat::Full);
+	ASSERT_TRUE(voting_round.startJournal(kJournalFileName, 1));
+	voting_round.vote(Option::A);
+	ASSERT_TRUE(voting_round.save(kOtherFileName));
+	voting_round.vote(Option::B);
+	ASSERT_TRUE(voting_round.save(kJournalFileName));
+	ASSERT_EQ(loadFile(kJournalFileName), voting_round.convertToText());
+	ASSERT_EQ(loadFile(kOtherFileName).size() + 1, voting_round.convertToText().size());
+	std::filesystem::remove(kOtherFileName);
+}
+void binaryEncodingIsNotJournaled() {
+	auto voting_round = createVotingRound(VotingFormat::Full);
+	voting_round.setEncoding(VotingRoundEncoding::Binary);
+	ASSERT_TRUE(voting_round.startJournal(kJournalFileName, 1));
+	ASSERT_FALSE(voting_round.isJournaling());
+}
+void undoRecordWithoutVotesIsRejected() {
+	auto const voting_round = createVotingRound(VotingFormat::Full);
+	ASSERT_FALSE(VotingRound::create(voting_round.convertToText() + std::string{ "undo" }).has_value());
+}
+void copiesAreNotJournaled() {
+	auto voting_round = createVotingRound(VotingFormat::Full);
+	ASSERT_TRUE(voting_round.startJournal(kJournalFileName, 1));
+	auto copied_voting_round = voting_round;
+	ASSERT_FALSE(copied_voting_round.isJournaling());
+	copied_voting_round.vote(Option::A);
+	ASSERT_TRUE(voting_round.isJournaling());
+	ASSERT_TRUE(voting_round.save(kJournalFileName));
+	ASSERT_EQ(loadFile(kJournalFileName), voting_round.convertToText());
+
+	copied_voting_round = voting_round;
+	ASSERT_FALSE(copied_voting_round.isJournaling());
+}
+void crashedJournalIsRecoveredWhenLoading() {
+	auto voting_round = createVotingRound(VotingFormat::Ranked);
+	ASSERT_TRUE(voting_round.startJournal(kJournalFileName, 1));
+	for (uint32_t i = 0; i < 6; i++) {
+		voting_round.vote(i % 2 == 0 ? Option::A : Option::B);
+	}
+	voting_round.undoVote();
+	auto const votes = voting_round.votes();
+	auto const voting_line = voting_round.currentVotingLine();
+	crashWhileJournaling(std::move(voting_round));
+
+	// A record being written during the crash is cut off, and left out
+	std::ofstream{ journalFileName(), std::ios::binary | std::ios::app } << "1 2";
+	ASSERT_EQ(loadJournal().value().votes().size(), 0ui64);
+
+	auto const loaded_voting_round = VotingRound::load(kJournalFileName);
+	ASSERT_TRUE(loaded_voting_round.has_value());
+	ASSERT_EQ(loaded_voting_round.value().votes(), votes);
+	ASSERT_EQ(loaded_voting_round.value().currentVotingLine(), voting_line);
+	ASSERT_TRUE(loaded_voting_round.value().isSaved());
+	ASSERT_FALSE(std::filesystem::exists(journalFileName()));
+	ASSERT_EQ(loadJournal().value().votes(), votes);
+}
+void unrecoveredJournalIsNotOverwritten() {
+	auto voting_round = createVotingRound(VotingFormat::Full);
+	ASSERT_TRUE(voting_round.startJournal(kJournalFileName, 1));
+	voting_round.vote(Option::A);
+	crashWhileJournaling(std::move(voting_round));
+	auto const journal_lines = loadFile(journalFileName());
+
+	auto other_voting_round = createVotingRound(VotingFormat::Full);
+	ASSERT_FALSE(other_voting_round.startJournal(kJournalFileName, 1));
+	ASSERT_FALSE(other_voting_round.isJournaling());
+	ASSERT_EQ(loadFile(journalFileName()), journal_lines);
+
+	ASSERT_EQ(VotingRound::load(kJournalFileName).value().votes().size(), 1ui64);
+	ASSERT_TRUE(other_voting_round.startJournal(kJournalFileName, 1));
+	ASSERT_EQ(loadJournal().value().votes().size(), 0ui64);
+}
+
+auto run_tests(std::string const& test) -> bool {
+	RUN_TEST_IF_ARGUMENT_EQUALS(journalStartsWithSavedVotingRound);
+	RUN_TEST_IF_ARGUMENT_EQUALS(journaledVotesAreAppendedWhenSaving);
+	RUN_TEST_IF_ARGUMENT_EQUALS(stoppingJournalDiscardsUnsavedVotes);
+	RUN_TEST_IF_ARGUMENT_EQUALS(journaledUndosAreReplayedOnLoad);
+	RUN_TEST_IF_ARGUMENT_EQUALS(journalIsSyncedInBatches);
+	RUN_TEST_IF_ARGUMENT_EQUALS(savingToAnotherFileKeepsJournal);
+	RUN_TEST_IF_ARGUMENT_EQUALS(binaryEncodingIsNotJournaled);
+	RUN_TEST_IF_ARGUMENT_EQUALS(undoRecordWithoutVotesIsRejected);
+	RUN_TEST_IF_ARGUMENT_EQUALS(copiesAreNotJournaled);
+	RUN_TEST_IF_ARGUMENT_EQUALS(crashedJournalIsRecoveredWhenLoading);
+	RUN_TEST_IF_ARGUMENT_EQUALS(unrecoveredJournalIsNotOverwritten);
+	return true;
+}
+
+} // namespace
+
+auto test_vote_journal(std::string const& test_case) -> int {
+	std::filesystem::remove(kJournalFileName);
+	std::filesystem::remove(kJournalFileName + std::string{ kJournalFileSuffix });
+	if (run_tests(test_case)) {
+		return 1;
+	}
+	std::filesystem::remove(kJournalFileName);
+	std::filesystem::remove(kJournalFileName + std::string{ kJournalFileSuffix });
+	return 0;
+}
@@ -0,0 +1,115 @@
+#include <random>
+#include <vector>
+
+#include "testing.h"
+#include "vote_log.h"
+
+namespace
+{
+
+/* -------------- Test helpers -------------- */
+auto randomVotes(size_t const number_of_votes, uint32_t const number_of_items) -> Votes {
+	std::default_random_engine engine(static_cast<uint32_t>(number_of_votes));
+	std::uniform_int_distribution<Index> item_distribution(0, number_of_items - 1);
+	std::bernoulli_distribution winner_distribution(0.5);
+	Votes votes{};
+	while (votes.size() < number_of_votes) {
+		Index const a_idx = item_distribution(engine);
+		Index const b_idx = item_distribution(engine);
+		if (a_idx != b_idx) {
+			votes.emplace_back(a_idx, b_idx, winner_distribution(engine) ? Option::B : Option::A);
+		}
+	}
+	return votes;
+}
+auto countedOneVoteAtATime(Votes const& votes, uint32_t const number_of_items) -> WinLossCounts {
+	WinLossCounts counts{ std::vector<uint32_t>(number_of_items, 0), std::vector<uint32_t>(number_of_items, 0) };
+	for (Vote const& vote : votes) {
+		counts.wins[vote.winner == Option::A ? vote.a_idx : vote.b_idx]++;
+		counts.losses[vote.winner == Option::A ? vote.b_idx : vote.a_idx]++;
+	}
+	return counts;
+}
+
+/* -------------- Tests -------------- */
+void votesAreKeptInColumns() {
+	auto const log = VoteLog::fromVotes(Votes{
+		Vote{ 0, 1, Option::A },
+		Vote{ 2, 0, Option::B },
+		Vote{ 1, 2, Option::B },
+	});
+	ASSERT_EQ(log.size(), 3ui64);
+	ASSERT_EQ(log.aIndices(), std::vector<Index>{ 0, 2, 1 });
+	ASSERT_EQ(log.bIndices(), std::vector<Index>{ 1, 0, 2 });
+	ASSERT_EQ(log.winnerBits(), std::vector<uint64_t>{ 0b110 });
+}
+void votesRoundTripThroughColumns() {
+	for (size_t number_of_votes : { 0, 1, 63, 64, 65, 1000 }) {
+		auto const votes = randomVotes(number_of_votes, 20);
+		auto const log = VoteLog::fromVotes(votes);
+		ASSERT_EQ(log.size(), number_of_votes);
+		ASSERT_EQ(log.winnerBits().size(), (number_of_votes + 63) / 64);
+		ASSERT_EQ(log.toVotes(), votes);
+		for (size_t i = 0; i < votes.size(); i++) {
+			ASSERT_EQ(log[i], votes[i]);
+		}
+	}
+}
+void countingMatchesCountingOneVoteAtATime() {
+	// Lengths around multiples of sixty-four, where the winner bits change words
+	constexpr uint32_t kNumberOfItems = 37;
+	for (size_t number_of_votes : { 0, 1, 63, 64, 65, 127, 128, 129, 10'007 }) {
+		auto const votes = randomVotes(number_of_votes, kNumberOfItems);
+		auto const expected = countedOneVoteAtATime(votes, kNumberOfItems);
+		auto const counts = countWinsAndLosses(VoteLog::fromVotes(votes), kNumberOfItems);
+		ASSERT_EQ(counts.wins, expected.wins);
+		ASSERT_EQ(counts.losses, expected.losses);
+	}
+}
+void countingRepeatedMatchups() {
+	Votes votes(100, Vote{ 3, 1, Option::B });
+	auto const counts = countWinsAndLosses(VoteLog::fromVotes(votes), 4);
+	ASSERT_EQ(counts.wins, std::vector<uint32_t>{ 0, 100, 0, 0 });
+	ASSERT_EQ(counts.losses, std::vector<uint32_t>{ 0, 0, 0, 100 });
+}
+void poppingVotesMatchesNeverAppendingThem() {
+	auto const votes = randomVotes(200, 20);
+	VoteLog log{};
+	for (size_t number_of_votes : { 200, 129, 128, 64, 63, 1, 0 }) {
+		while (log.size() < votes.size()) {
+			log.append(votes[log.size()]);
+		}
+		while (log.size() > number_of_votes) {
+			log.popBack();
+		}
+		ASSERT_TRUE(log == VoteLog::fromVotes(Votes(votes.begin(), votes.begin() + number_of_votes)));
+	}
+}
+void votesAreIteratedInOrder() {
+	auto const votes = randomVotes(100, 20);
+	auto const log = VoteLog::fromVotes(votes);
+	Votes iterated_votes{};
+	for (Vote const vote : log) {
+		iterated_votes.push_back(vote);
+	}
+	ASSERT_EQ(iterated_votes, votes);
+	ASSERT_EQ(log.back(), votes.back());
+}
+auto run_tests(std::string const& test) -> bool {
+	RUN_TEST_IF_ARGUMENT_EQUALS(votesAreKeptInColumns);
+	RUN_TEST_IF_ARGUMENT_EQUALS(votesRoundTripThroughColumns);
+	RUN_TEST_IF_ARGUMENT_EQUALS(countingMatchesCountingOneVoteAtATime);
+	RUN_TEST_IF_ARGUMENT_EQUALS(countingRepeatedMatchups);
+	RUN_TEST_IF_ARGUMENT_EQUALS(poppingVotesMatchesNeverAppendingThem);
+	RUN_TEST_IF_ARGUMENT_EQUALS(votesAreIteratedInOrder);
+	return true;
+}
+
+} // namespace
+
+auto test_vote_log(std::string const& test_case) -> int {
+	if (run_tests(test_case)) {
+		return 1;
+	}
+	return 0;
+}
@@ -8,10 +8,12 @@ void charToFormatWithValidOptions() {
 	ASSERT_EQ(characterToVotingFormat('f'), VotingFormat::Full);
 	ASSERT_EQ(characterToVotingFormat('r'), VotingFormat::Reduced);
 	ASSERT_EQ(characterToVotingFormat('i'), VotingFormat::Ranked);
+	ASSERT_EQ(characterToVotingFormat('m'), VotingFormat::MergeInsertion);
+	ASSERT_EQ(characterToVotingFormat('a'), VotingFormat::Adaptive);
 }
 void charToFormatWithInvalidOptions() {
 	for (char letter = 'a'; letter <= 'z'; letter++) {
-		if (letter == 'f' || letter == 'r' || letter == 'i') {
+		if (letter == 'f' || letter == 'r' || letter == 'i' || letter == 'm' || letter == 'a') {
 			continue;
 		}
 		ASSERT_EQ(characterToVotingFormat(letter), VotingFormat::Invalid);
@@ -21,6 +23,8 @@ void stringToFormatWithValidOptions() {
 	ASSERT_EQ(stringToVotingFormat("full"), VotingFormat::Full);
 	ASSERT_EQ(stringToVotingFormat("reduced"), VotingFormat::Reduced);
 	ASSERT_EQ(stringToVotingFormat("ranked"), VotingFormat::Ranked);
+	ASSERT_EQ(stringToVotingFormat("merge"), VotingFormat::MergeInsertion);
+	ASSERT_EQ(stringToVotingFormat("adaptive"), VotingFormat::Adaptive);
 }
 void stringToFormatWithInalidOptions() {
 	ASSERT_EQ(stringToVotingFormat("ful"), VotingFormat::Invalid);
@@ -31,6 +35,8 @@ void formatToString() {
 	ASSERT_EQ(votingFormatToString(VotingFormat::Full), std::string{ "full" });
 	ASSERT_EQ(votingFormatToString(VotingFormat::Reduced), std::string{ "reduced" });
 	ASSERT_EQ(votingFormatToString(VotingFormat::Ranked), std::string{ "ranked" });
+	ASSERT_EQ(votingFormatToString(VotingFormat::MergeInsertion), std::string{ "merge" });
+	ASSERT_EQ(votingFormatToString(VotingFormat::Adaptive), std::string{ "adaptive" });
 	ASSERT_EQ(votingFormatToString(VotingFormat::Invalid), std::string{ "" });
 }
 
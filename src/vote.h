@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cassert>
 #include <cstdint>
+#include <optional>
 #include <vector>
 
 using Index = uint32_t;
@@ -10,10 +12,35 @@ enum class Option : uint32_t {
 	B
 };
 
+// Votes keep the winner in the top bit of index B, so item indices in votes are limited to the
+// bits below it
+constexpr uint32_t kVoteIndexBits = 31;
+constexpr Index kMaxVoteIndex = (Index{ 1 } << kVoteIndexBits) - 1;
+// Index, if it can be stored in a vote
+constexpr auto toVoteIndex(uint64_t const idx) noexcept -> std::optional<Index> {
+	if (idx > kMaxVoteIndex) {
+		return std::nullopt;
+	}
+	return static_cast<Index>(idx);
+}
+
+// Packed into 8 bytes, since rounds and combined sessions keep millions of votes in memory.
+// The constructor lets votes be brace-initialized like an aggregate, which some compilers refuse
+// for an enum bit-field. Index B would be truncated by its bit-field, so it must already be
+// checked, such as with toVoteIndex().
 struct Vote {
+	Vote() = default;
+	constexpr Vote(Index const a, Index const b, Option const option) noexcept
+		: a_idx{ a }
+		, b_idx{ b }
+		, winner{ option } {
+		assert(b <= kMaxVoteIndex);
+	}
+
 	Index a_idx{};
-	Index b_idx{};
-	Option winner{};
+	Index b_idx : kVoteIndexBits {};
+	Option winner : 1 {};
 };
+static_assert(sizeof(Vote) == 8);
 auto operator==(Vote const& a, Vote const& b) -> bool;
 using Votes = std::vector<Vote>;
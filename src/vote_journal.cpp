@@ -0,0 +1,163 @@
+#include "vote_journal.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "helpers.h"
+#include "print.h"
+
+namespace
+{
+
+auto syncToDisk(std::FILE* file) -> bool {
+	if (std::fflush(file) != 0) {
+		return false;
+	}
+#ifdef _WIN32
+	return _commit(_fileno(file)) == 0;
+#else
+	return fsync(fileno(file)) == 0;
+#endif
+}
+auto appendToFile(std::string const& file_name, std::string const& data) -> bool {
+	std::FILE* const file = std::fopen(file_name.c_str(), "ab");
+	if (file == nullptr) {
+		return false;
+	}
+	bool const written = std::fwrite(data.data(), 1, data.size(), file) == data.size() && syncToDisk(file);
+	std::fclose(file);
+	return written;
+}
+
+} // namespace
+
+auto VoteJournal::open(std::string const& file_name, uint32_t const sync_interval) -> std::unique_ptr<VoteJournal> {
+	std::string const journal_file_name = file_name + std::string{ kJournalFileSuffix };
+	std::FILE* const journal_file = std::fopen(journal_file_name.c_str(), "w+b");
+	if (journal_file == nullptr) {
+		printError("Could not open journal file " + journal_file_name);
+		return nullptr;
+	}
+	return std::unique_ptr<VoteJournal>(new VoteJournal(journal_file, file_name, sync_interval));
+}
+auto VoteJournal::leftoverRecords(std::string const& file_name) -> std::vector<std::string> {
+	std::vector<std::string> records{};
+	std::ifstream journal_file(file_name + std::string{ kJournalFileSuffix }, std::ios::binary);
+	if (!journal_file.is_open()) {
+		return records;
+	}
+	std::string const data(std::istreambuf_iterator<char>(journal_file), std::istreambuf_iterator<char>{});
+
+	// Each record ends with a line break, so anything after the last one was cut off
+	for (size_t start = 0, end = 0; (end = data.find('\n', start)) != std::string::npos; start = end + 1) {
+		records.emplace_back(data, start, end - start);
+	}
+	return records;
+}
+auto VoteJournal::recover(std::string const& file_name, std::vector<std::string> const& records) -> bool {
+	std::string data{};
+	for (auto const& record : records) {
+		data += record + '\n';
+	}
+	if (!appendToFile(file_name, data)) {
+		printError("Could not append recovered votes to " + file_name);
+		return false;
+	}
+	std::remove((file_name + std::string{ kJournalFileSuffix }).c_str());
+	return true;
+}
+VoteJournal::VoteJournal(std::FILE* journal_file, std::string const& file_name, uint32_t const sync_interval)
+	: journal_file_{ journal_file }
+	, file_name_{ file_name }
+	, journal_file_name_{ file_name + std::string{ kJournalFileSuffix } }
+	, sync_interval_{ std::max(sync_interval, 1u) } {
+}
+VoteJournal::~VoteJournal() {
+	if (journal_file_ != nullptr) {
+		std::fclose(journal_file_);
+	}
+	std::remove(journal_file_name_.c_str());
+}
+auto VoteJournal::appendVote(Vote const& vote) -> bool {
+	return append(voteRecord(vote));
+}
+auto VoteJournal::appendUndo() -> bool {
+	return append(std::string{ kUndoRecord });
+}
+auto VoteJournal::save() -> bool {
+	if (failed_) {
+		return false;
+	}
+
+	// Read back the records since the last save
+	std::string records{};
+	if (std::fflush(journal_file_) != 0 || std::fseek(journal_file_, 0, SEEK_SET) != 0) {
+		return fail("Could not read journal " + journal_file_name_);
+	}
+	char buffer[4096]{};
+	for (size_t size = 0; (size = std::fread(buffer, 1, sizeof(buffer), journal_file_)) > 0;) {
+		records.append(buffer, size);
+	}
+	if (std::ferror(journal_file_) != 0) {
+		return fail("Could not read journal " + journal_file_name_);
+	}
+
+	if (!records.empty() && !appendToFile(file_name_, records)) {
+		return fail("Could not append journal to " + file_name_);
+	}
+
+	// Start over with an empty journal
+	journal_file_ = std::freopen(journal_file_name_.c_str(), "w+b", journal_file_);
+	if (journal_file_ == nullptr) {
+		return fail("Could not reopen journal " + journal_file_name_);
+	}
+	unsynced_records_ = 0;
+	return true;
+}
+auto VoteJournal::hasFailed() const noexcept -> bool {
+	return failed_;
+}
+auto VoteJournal::fileName() const noexcept -> std::string const& {
+	return file_name_;
+}
+auto VoteJournal::journalFileName() const noexcept -> std::string const& {
+	return journal_file_name_;
+}
+auto VoteJournal::syncInterval() const noexcept -> uint32_t {
+	return sync_interval_;
+}
+auto VoteJournal::append(std::string const& record) -> bool {
+	if (failed_) {
+		return false;
+	}
+	if (std::fputs((record + '\n').c_str(), journal_file_) < 0) {
+		return fail("Could not append to journal " + journal_file_name_);
+	}
+	if (++unsynced_records_ >= sync_interval_) {
+		return sync();
+	}
+	return true;
+}
+auto VoteJournal::sync() -> bool {
+	if (!syncToDisk(journal_file_)) {
+		return fail("Could not write journal to " + journal_file_name_);
+	}
+	unsynced_records_ = 0;
+	return true;
+}
+auto VoteJournal::fail(std::string const& error) -> bool {
+	printError(error);
+	failed_ = true;
+	return false;
+}
+
+auto voteRecord(Vote const& vote) -> std::string {
+	return std::to_string(vote.a_idx) + " " + std::to_string(vote.b_idx) + " " + std::to_string(to_underlying(vote.winner));
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "vote.h"
+
+constexpr std::string_view kUndoRecord = "undo";
+// Records not yet saved are kept next to the voting round file, in a file with this suffix
+constexpr std::string_view kJournalFileSuffix = ".journal";
+
+// Records votes and undos of a saved voting round, so that saving appends only the records since
+// the last save to the voting round file, instead of rewriting it.
+// Until then, records are kept in a journal file next to it, which is flushed to disk after every
+// sync interval. Destroying the journal discards them, leaving the file as it was last saved.
+// If the program ends without doing either, the records are left in the journal file to be recovered.
+class VoteJournal final {
+public:
+	// Starts an empty journal, so records left in an earlier one must be recovered first
+	static auto open(std::string const& file_name, uint32_t const sync_interval) -> std::unique_ptr<VoteJournal>;
+	// Records left next to the voting round file, without any record cut off while being written
+	static auto leftoverRecords(std::string const& file_name) -> std::vector<std::string>;
+	// Appends leftover records to the voting round file, and removes the journal file they were left in
+	static auto recover(std::string const& file_name, std::vector<std::string> const& records) -> bool;
+	~VoteJournal();
+	VoteJournal(VoteJournal const&) = delete;
+	auto operator=(VoteJournal const&) -> VoteJournal& = delete;
+
+	auto appendVote(Vote const& vote) -> bool;
+	auto appendUndo() -> bool;
+	// Appends the records since the last save to the voting round file, and starts over
+	auto save() -> bool;
+	// Whether any record couldn't be recorded or saved, so the file can't be brought up to date
+	auto hasFailed() const noexcept -> bool;
+	auto fileName() const noexcept -> std::string const&;
+	auto journalFileName() const noexcept -> std::string const&;
+	auto syncInterval() const noexcept -> uint32_t;
+
+private:
+	VoteJournal(std::FILE* journal_file, std::string const& file_name, uint32_t const sync_interval);
+	auto append(std::string const& record) -> bool;
+	auto sync() -> bool;
+	auto fail(std::string const& error) -> bool;
+
+	std::FILE* journal_file_{ nullptr };
+	std::string file_name_{};
+	std::string journal_file_name_{};
+	uint32_t sync_interval_{ 1 };
+	uint32_t unsynced_records_{ 0 };
+	bool failed_{ false };
+};
+
+auto voteRecord(Vote const& vote) -> std::string;
@@ -0,0 +1,127 @@
+#include "vote_log.h"
+
+namespace
+{
+
+constexpr size_t kVotesPerWord = 64;
+
+auto bWon(std::vector<uint64_t> const& winner_bits, size_t const i) noexcept -> bool {
+	return ((winner_bits[i / kVotesPerWord] >> (i % kVotesPerWord)) & 1) != 0;
+}
+
+} // namespace
+
+VoteLog::Iterator::Iterator(VoteLog const* log, size_t const i) noexcept
+	: log_{ log }
+	, i_{ i } {
+}
+auto VoteLog::Iterator::operator*() const noexcept -> Vote {
+	return (*log_)[i_];
+}
+auto VoteLog::Iterator::operator++() noexcept -> Iterator& {
+	i_++;
+	return *this;
+}
+auto VoteLog::Iterator::operator++(int) noexcept -> Iterator {
+	Iterator const previous = *this;
+	i_++;
+	return previous;
+}
+
+VoteLog::VoteLog(std::initializer_list<Vote> const votes) {
+	reserve(votes.size());
+	for (Vote const& vote : votes) {
+		append(vote);
+	}
+}
+auto VoteLog::fromVotes(Votes const& votes) -> VoteLog {
+	VoteLog log{};
+	log.reserve(votes.size());
+	for (Vote const& vote : votes) {
+		log.append(vote);
+	}
+	return log;
+}
+
+void VoteLog::reserve(size_t const number_of_votes) {
+	a_indices_.reserve(number_of_votes);
+	b_indices_.reserve(number_of_votes);
+	winner_bits_.reserve((number_of_votes + kVotesPerWord - 1) / kVotesPerWord);
+}
+void VoteLog::append(Vote const& vote) {
+	size_t const i = a_indices_.size();
+	if (i % kVotesPerWord == 0) {
+		winner_bits_.push_back(0);
+	}
+	if (vote.winner == Option::B) {
+		winner_bits_.back() |= uint64_t{ 1 } << (i % kVotesPerWord);
+	}
+	a_indices_.push_back(vote.a_idx);
+	b_indices_.push_back(vote.b_idx);
+}
+void VoteLog::popBack() noexcept {
+	a_indices_.pop_back();
+	b_indices_.pop_back();
+
+	// Clear the bit of the vote, so logs with the same votes compare equal
+	size_t const i = a_indices_.size();
+	if (i % kVotesPerWord == 0) {
+		winner_bits_.pop_back();
+	}
+	else {
+		winner_bits_.back() &= ~(uint64_t{ 1 } << (i % kVotesPerWord));
+	}
+}
+
+auto VoteLog::size() const noexcept -> size_t {
+	return a_indices_.size();
+}
+auto VoteLog::empty() const noexcept -> bool {
+	return a_indices_.empty();
+}
+auto VoteLog::operator[](size_t const i) const noexcept -> Vote {
+	return { a_indices_[i], b_indices_[i], bWon(winner_bits_, i) ? Option::B : Option::A };
+}
+auto VoteLog::back() const noexcept -> Vote {
+	return (*this)[size() - 1];
+}
+auto VoteLog::begin() const noexcept -> Iterator {
+	return { this, 0 };
+}
+auto VoteLog::end() const noexcept -> Iterator {
+	return { this, size() };
+}
+auto VoteLog::toVotes() const -> Votes {
+	return { begin(), end() };
+}
+
+auto VoteLog::aIndices() const noexcept -> std::vector<Index> const& {
+	return a_indices_;
+}
+auto VoteLog::bIndices() const noexcept -> std::vector<Index> const& {
+	return b_indices_;
+}
+auto VoteLog::winnerBits() const noexcept -> std::vector<uint64_t> const& {
+	return winner_bits_;
+}
+
+/* -------------- Counting -------------- */
+auto countWinsAndLosses(VoteLog const& votes, size_t const number_of_items) -> WinLossCounts {
+	WinLossCounts counts{ std::vector<uint32_t>(number_of_items, 0), std::vector<uint32_t>(number_of_items, 0) };
+
+	// Raw pointers, since the counts are the same type as the indices and could otherwise alias
+	// the vectors' own pointers, which would then be read again for every vote
+	Index const* const a_indices = votes.aIndices().data();
+	Index const* const b_indices = votes.bIndices().data();
+	uint64_t const* const winner_bits = votes.winnerBits().data();
+	uint32_t* const wins = counts.wins.data();
+	uint32_t* const losses = counts.losses.data();
+	for (size_t i = 0; i < votes.size(); i++) {
+		// Selected without branching, since which option won is as good as random
+		Index const b_won = static_cast<Index>((winner_bits[i / kVotesPerWord] >> (i % kVotesPerWord)) & 1);
+		Index const swap = (a_indices[i] ^ b_indices[i]) & (Index{ 0 } - b_won);
+		wins[a_indices[i] ^ swap]++;
+		losses[b_indices[i] ^ swap]++;
+	}
+	return counts;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+#include "vote.h"
+
+// Votes stored column-wise, as an array of A indices, an array of B indices and a bitmask of
+// winners, so passes over millions of votes read only the columns they need.
+// Votes are read back by value, since they aren't stored as Vote.
+class VoteLog final {
+public:
+	class Iterator final {
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = Vote;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = Vote;
+
+		Iterator() = default;
+		Iterator(VoteLog const* log, size_t const i) noexcept;
+
+		auto operator*() const noexcept -> Vote;
+		auto operator++() noexcept -> Iterator&;
+		auto operator++(int) noexcept -> Iterator;
+		auto operator==(Iterator const& other) const noexcept -> bool = default;
+	private:
+		VoteLog const* log_{ nullptr };
+		size_t i_{ 0 };
+	};
+
+	VoteLog() = default;
+	VoteLog(std::initializer_list<Vote> const votes);
+	static auto fromVotes(Votes const& votes) -> VoteLog;
+
+	void reserve(size_t const number_of_votes);
+	void append(Vote const& vote);
+	void popBack() noexcept;
+
+	auto size() const noexcept -> size_t;
+	auto empty() const noexcept -> bool;
+	auto operator[](size_t const i) const noexcept -> Vote;
+	auto back() const noexcept -> Vote;
+	auto begin() const noexcept -> Iterator;
+	auto end() const noexcept -> Iterator;
+	auto toVotes() const -> Votes;
+
+	auto aIndices() const noexcept -> std::vector<Index> const&;
+	auto bIndices() const noexcept -> std::vector<Index> const&;
+	// Bit i % 64 of word i / 64 is set if B won vote i. Bits past the last vote are never set.
+	auto winnerBits() const noexcept -> std::vector<uint64_t> const&;
+
+	auto operator==(VoteLog const& other) const noexcept -> bool = default;
+
+private:
+	std::vector<Index> a_indices_{};
+	std::vector<Index> b_indices_{};
+	std::vector<uint64_t> winner_bits_{};
+};
+
+/* -------------- Counting -------------- */
+struct WinLossCounts {
+	std::vector<uint32_t> wins{};
+	std::vector<uint32_t> losses{};
+};
+// Wins and losses of each item in the votes. Every index must be smaller than the number of items.
+auto countWinsAndLosses(VoteLog const& votes, size_t const number_of_items) -> WinLossCounts;
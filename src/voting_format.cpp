@@ -8,11 +8,15 @@ auto characterToVotingFormat(char const c) noexcept -> VotingFormat {
 		return VotingFormat::Reduced;
 	case 'i':
 		return VotingFormat::Ranked;
+	case 'm':
+		return VotingFormat::MergeInsertion;
+	case 'a':
+		return VotingFormat::Adaptive;
 	default:
 		return VotingFormat::Invalid;
 	}
 }
-auto stringToVotingFormat(std::string const& s) noexcept -> VotingFormat {
+auto stringToVotingFormat(std::string_view const s) noexcept -> VotingFormat {
 	if (s == "reduced") {
 		return VotingFormat::Reduced;
 	}
@@ -22,6 +26,12 @@ auto stringToVotingFormat(std::string const& s) noexcept -> VotingFormat {
 	if (s == "ranked") {
 		return VotingFormat::Ranked;
 	}
+	if (s == "merge") {
+		return VotingFormat::MergeInsertion;
+	}
+	if (s == "adaptive") {
+		return VotingFormat::Adaptive;
+	}
 	return VotingFormat::Invalid;
 }
 auto votingFormatToString(VotingFormat f) noexcept -> std::string {
@@ -32,6 +42,10 @@ auto votingFormatToString(VotingFormat f) noexcept -> std::string {
 		return "reduced";
 	case VotingFormat::Ranked:
 		return "ranked";
+	case VotingFormat::MergeInsertion:
+		return "merge";
+	case VotingFormat::Adaptive:
+		return "adaptive";
 	case VotingFormat::Invalid:
 	default:
 		return "";
@@ -2,14 +2,17 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 enum class VotingFormat : uint32_t {
 	Invalid,
 	Full,
 	Ranked,
 	Reduced,
+	MergeInsertion,
+	Adaptive,
 };
 
 auto characterToVotingFormat(char const c) noexcept -> VotingFormat;
-auto stringToVotingFormat(std::string const& s) noexcept -> VotingFormat;
+auto stringToVotingFormat(std::string_view const s) noexcept -> VotingFormat;
 auto votingFormatToString(VotingFormat f) noexcept -> std::string;
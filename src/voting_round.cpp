@@ -1,44 +1,86 @@
 #include "voting_round.h"
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
 #include <chrono>
+#include <limits>
+#include <numeric>
 #include <random>
 #include <unordered_set>
 
+#include "binary_io.h"
+#include "bradley_terry.h"
 #include "constants.h"
 #include "helpers.h"
+#include "matchup_bitmap.h"
 #include "print.h"
+#include "profiler.h"
 
 namespace
 {
 
-auto getSortedIndexPair(IndexPair const& index_pair) noexcept -> IndexPair {
-	if (index_pair.first < index_pair.second) {
-		return index_pair;
-	}
-	return std::make_pair(index_pair.second, index_pair.first);
-}
+// Leading byte is not valid UTF-8, so the binary format can't be mistaken for text
+constexpr std::string_view kBinaryMagic = "\x89PWR";
+// Version 2 added the pair order. Version 1 rounds are shuffled.
+// Version 3 added the rating deviation of adaptive rounds. Earlier adaptive rounds use the default one.
+constexpr uint8_t kBinaryVersion = 3;
+constexpr uint8_t kFirstBinaryVersion = 1;
+// Follows the voting format in text files of permuted rounds
+constexpr std::string_view kPermutedPairsMarker = "permuted";
+// Follows the voting format in text files of adaptive rounds. Files without it use the default deviation.
+constexpr std::string_view kRatingDeviationPrefix = "rating deviation ";
+
 auto itemsAreUnique(Items const& items) -> bool {
 	return items.size() == std::unordered_set<Item>{ items.begin(), items.end() }.size();
 }
-auto votingIndicesAreSmallerThanNumberOfItems(Votes const& votes, uint32_t const number_of_items) noexcept -> bool {
-	for (auto const& vote : votes) {
-		if (vote.a_idx >= number_of_items || vote.b_idx >= number_of_items) {
-			return false;
+auto votingIndicesAreSmallerThanNumberOfItems(VoteLog const& votes, uint32_t const number_of_items) noexcept -> bool {
+	auto const isSmaller = [number_of_items](Index const idx) noexcept {
+		return idx < number_of_items;
+	};
+	return std::all_of(votes.aIndices().begin(), votes.aIndices().end(), isSmaller) &&
+		std::all_of(votes.bIndices().begin(), votes.bIndices().end(), isSmaller);
+}
+auto hasMatchupsAgainstSameItem(VoteLog const& votes) noexcept -> bool {
+	for (size_t i = 0; i < votes.size(); i++) {
+		if (votes.aIndices()[i] == votes.bIndices()[i]) {
+			return true;
 		}
 	}
-	return true;
+	return false;
 }
-auto hasDuplicateMatchups(Votes const& votes) -> bool {
-	std::unordered_set<IndexPair, IndexPairHash> index_pair_set{};
-	for (auto const& vote : votes) {
-		index_pair_set.insert(getSortedIndexPair({ vote.a_idx, vote.b_idx }));
+auto loadedItemsAreValid(Items const& items) -> bool {
+	if (items.size() < 2) {
+		printError("Parsed items are fewer than two");
+		return false;
 	}
-	return index_pair_set.size() != votes.size();
+	if (items.size() - 1 > kMaxVoteIndex) {
+		printError("Parsed items are too many");
+		return false;
+	}
+	if (!itemsAreUnique(items)) {
+		printError("Parsed items are not unique");
+		return false;
+	}
+	// Text files separate items with empty lines, so such items couldn't be converted to text.
+	// Only binary files can contain them.
+	bool const has_unwritable_item = std::any_of(items.begin(), items.end(), [](Item const& item) noexcept {
+		return item.empty() || item.find_first_of("\r\n") != Item::npos;
+	});
+	if (has_unwritable_item) {
+		printError("Parsed items are empty or contain line breaks");
+		return false;
+	}
+	return true;
 }
 auto generateSeed() noexcept -> Seed {
 	return static_cast<Seed>(std::chrono::system_clock::now().time_since_epoch().count());
 }
+auto newPairOrder(size_t const number_of_items, VotingFormat const voting_format) noexcept -> PairOrder {
+	bool const too_many_pairs = sumOfFirstIntegers(number_of_items - 1ull) > kMaxMaterializedIndexPairs;
+	return voting_format == VotingFormat::Full && too_many_pairs ? PairOrder::Permuted : PairOrder::Shuffled;
+}
 auto generateIndexPairs(uint32_t const number_of_items) -> IndexPairs {
 	if (number_of_items < 2) {
 		printError("Number of items (" + std::to_string(number_of_items) + ") is less than two");
@@ -71,13 +113,6 @@ auto hasInvalidScheduledVotes(IndexPairs const& index_pairs, uint32_t number_of_
 	}
 	return false;
 }
-auto hasDuplicateScheduledVotes(IndexPairs const& index_pairs) -> bool {
-	std::unordered_set<IndexPair, IndexPairHash> index_pair_set{};
-	for (auto const& index_pair : index_pairs) {
-		index_pair_set.insert(getSortedIndexPair(index_pair));
-	}
-	return index_pair_set.size() != index_pairs.size();
-}
 auto expectedIndexPairs(Items const& items, bool reduced_voting) noexcept -> uint32_t {
 	if (items.size() < 2) {
 		return 0;
@@ -111,44 +146,54 @@ auto hasDuplicateVotes(Votes const& votes) -> bool {
 	}
 	return index_pair_set.size() != votes.size();
 }
-auto generateIndexPairWithOffset(uint32_t const i, uint32_t const offset, uint32_t const number_of_items) noexcept -> IndexPair {
-	return std::make_pair(i, (i + offset) % number_of_items);
-}
-void removeNSpacedPairs(IndexPairs& index_pairs, uint32_t const offset, uint32_t const number_of_items) {
-	for (uint32_t i = 0; i < number_of_items; i++) {
-		// Since pairs are generated with the first element always being smaller than the second,
-		// the order must be ensured here.
-		auto const pair = getSortedIndexPair(generateIndexPairWithOffset(i, offset, number_of_items));
-		index_pairs.erase(std::remove(index_pairs.begin(), index_pairs.end(), pair), index_pairs.end());
-	}
-}
-auto pruneVotes(IndexPairs const& index_pairs, uint32_t const number_of_items, uint32_t const pruning_iterations) -> IndexPairs {
-	IndexPairs reduced_pairs = index_pairs;
-	for (uint32_t index_offset = 0; index_offset < pruning_iterations; index_offset++) {
-		removeNSpacedPairs(reduced_pairs, index_offset + 1, number_of_items);
+// Pairs scheduled by full and reduced rounds. Reduced rounds prune a few pairs per item.
+auto numberOfPairs(uint32_t const number_of_items, VotingFormat const voting_format) noexcept -> size_t {
+	size_t const number_of_full_pairs = sumOfFirstIntegers(number_of_items - 1ull);
+	if (voting_format == VotingFormat::Reduced) {
+		return number_of_full_pairs - static_cast<size_t>(number_of_items) * pruningAmount(number_of_items);
 	}
-	return reduced_pairs;
+	return number_of_full_pairs;
 }
-auto reduceVotes(IndexPairs const& index_pairs, uint32_t const number_of_items) -> IndexPairs {
+auto generateReducedIndexPairs(uint32_t const number_of_items) -> IndexPairs {
 	if (number_of_items < kMinimumItemsForPruning) {
 		printError("Too few items (" + std::to_string(number_of_items) + ") to reduce voting. No reduction performed");
-		return index_pairs;
+		return generateIndexPairs(number_of_items);
 	}
-	return pruneVotes(index_pairs, number_of_items, pruningAmount(number_of_items));
+
+	// Pruning removes every pair of items whose distance, wrapping around the items, is at most the
+	// pruning amount. Only pairs with a distance in (pruning, N - pruning) remain, so each item is
+	// directly paired with the few remaining items after it, in the same order as the full pairs.
+	uint32_t const pruning = pruningAmount(number_of_items);
+	IndexPairs index_pairs;
+	index_pairs.reserve(numberOfPairs(number_of_items, VotingFormat::Reduced));
+	for (uint32_t item_a = 0; item_a + pruning + 1 < number_of_items; item_a++) {
+		uint32_t const last_item_b = std::min(number_of_items - 1, item_a + number_of_items - pruning - 1);
+		for (uint32_t item_b = item_a + pruning + 1; item_b <= last_item_b; item_b++) {
+			index_pairs.emplace_back(item_a, item_b);
+		}
+	}
+	return index_pairs;
 }
-auto parseVote(std::string const& str) -> Vote {
-	std::vector<std::string> words = parseWords(str);
-	if (words.size() != 3) {
-		printError("Invalid vote format. Number of words (" + std::to_string(words.size()) + ") doesn't equal 3");
+auto parseVote(std::string_view const str) -> Vote {
+	std::string_view remaining = str;
+	std::string_view const word_a = nextWord(remaining);
+	std::string_view const word_b = nextWord(remaining);
+	std::string_view const word_winner = nextWord(remaining);
+	if (word_winner.empty() || !nextWord(remaining).empty()) {
+		printError("Invalid vote format. Number of words (" + std::to_string(parseWords(str).size()) + ") doesn't equal 3");
 		return {};
 	}
-	std::optional<uint32_t> option_a = parseNumber(words[0]);
-	std::optional<uint32_t> option_b = parseNumber(words[1]);
-	std::optional<uint32_t> winner = parseNumber(words[2]);
+	std::optional<uint32_t> option_a = parseNumber(word_a);
+	std::optional<uint32_t> option_b = parseNumber(word_b);
+	std::optional<uint32_t> winner = parseNumber(word_winner);
 	if (!(option_a.has_value() && option_b.has_value() && winner.has_value())) {
 		printError("Unable to parse vote");
 		return {};
 	}
+	if (!toVoteIndex(option_a.value()).has_value() || !toVoteIndex(option_b.value()).has_value()) {
+		printError("Vote index is too large");
+		return {};
+	}
 	if (!(winner.value() == 0 || winner.value() == 1)) {
 		printError("Voted option is invalid");
 		return {};
@@ -159,6 +204,9 @@ auto parseVote(std::string const& str) -> Vote {
 		option_b.value(),
 		static_cast<Option>(winner.value()) };
 }
+auto isBinaryVotingRound(std::string_view const data) noexcept -> bool {
+	return data.starts_with(kBinaryMagic);
+}
 auto findMaxLength(Items const& items) noexcept -> size_t {
 	if (items.empty()) {
 		return 0;
@@ -188,43 +236,147 @@ auto counterString(size_t counter, std::string const& total_str) -> std::string
 		"/" + std::string(max_length - total_length, ' ') + total_str + ")";
 }
 
+// Items at the given positions of an item order
+auto positionsToItemOrder(ItemOrder const& item_order, std::vector<Index> const& positions) -> ItemOrder {
+	ItemOrder result{};
+	result.reserve(positions.size());
+	for (Index const position : positions) {
+		result.push_back(item_order[position]);
+	}
+	return result;
+}
+
 } // namespace
 
 
-auto VotingRound::ScoreBased::create(uint32_t const number_of_items, VotingFormat const voting_format) -> std::optional<VotingRound::ScoreBased> {
+auto VotingRound::ScoreBased::create(uint32_t const number_of_items, VotingFormat const voting_format, PairOrder const pair_order) -> std::optional<VotingRound::ScoreBased> {
 	if (!(voting_format == VotingFormat::Full || voting_format == VotingFormat::Reduced)) {
 		return std::nullopt;
 	}
 
+	// Scheduled votes are counted in 32 bits
+	if (numberOfPairs(number_of_items, voting_format) > std::numeric_limits<uint32_t>::max()) {
+		printError("Number of items (" + std::to_string(number_of_items) + ") is too large to pair up");
+		return std::nullopt;
+	}
+
 	VotingRound::ScoreBased score_based{};
-	score_based.index_pairs_ = generateIndexPairs(number_of_items);
+	if (pair_order == PairOrder::Permuted) {
+		score_based.pair_schedule_ = PairSchedule::create(number_of_items);
+		if (!score_based.pair_schedule_.has_value()) {
+			return std::nullopt;
+		}
+		return score_based;
+	}
 	if (voting_format == VotingFormat::Reduced) {
-		score_based.index_pairs_ = reduceVotes(score_based.index_pairs_, number_of_items);
+		score_based.index_pairs_ = generateReducedIndexPairs(number_of_items);
+	}
+	else {
+		score_based.index_pairs_ = generateIndexPairs(number_of_items);
 	}
 	return score_based;
 }
 auto VotingRound::ScoreBased::shuffle(Seed const seed) -> bool {
+	if (pair_schedule_.has_value()) {
+		pair_schedule_.value().shuffle(seed);
+		return true;
+	}
 	std::default_random_engine engine(seed);
 	std::shuffle(index_pairs_.begin(), index_pairs_.end(), engine);
 	return true;
 }
 auto VotingRound::ScoreBased::currentIndexPair(uint32_t const counter) const -> IndexPair {
+	if (pair_schedule_.has_value()) {
+		return pair_schedule_.value().indexPair(counter);
+	}
 	return index_pairs_[counter];
 }
-auto VotingRound::ScoreBased::indexPairs() const noexcept -> IndexPairs const& {
-	return index_pairs_;
-}
 auto VotingRound::ScoreBased::numberOfScheduledVotes() const noexcept -> uint32_t {
+	if (pair_schedule_.has_value()) {
+		return static_cast<uint32_t>(pair_schedule_.value().size());
+	}
 	return static_cast<uint32_t>(index_pairs_.size());
 }
 
-auto VotingRound::RankBased::create() -> std::optional<VotingRound::RankBased> {
+ItemsView::Iterator::Iterator(Items const& items, Index const* position) noexcept :
+	items_{ &items },
+	position_{ position } {
+}
+auto ItemsView::Iterator::operator*() const noexcept -> Item const& {
+	return (*items_)[*position_];
+}
+auto ItemsView::Iterator::operator->() const noexcept -> Item const* {
+	return &(*items_)[*position_];
+}
+auto ItemsView::Iterator::operator++() noexcept -> Iterator& {
+	++position_;
+	return *this;
+}
+auto ItemsView::Iterator::operator++(int) noexcept -> Iterator {
+	Iterator const previous = *this;
+	++position_;
+	return previous;
+}
+auto ItemsView::Iterator::operator==(Iterator const& other) const noexcept -> bool {
+	return position_ == other.position_;
+}
+
+ItemsView::ItemsView(Items const& items, ItemOrder const& item_order) noexcept :
+	items_{ &items },
+	item_order_{ &item_order } {
+}
+ItemsView::ItemsView(Items const& items, ItemOrder&& item_order) :
+	items_{ &items },
+	owned_item_order_{ std::make_shared<ItemOrder const>(std::move(item_order)) },
+	item_order_{ owned_item_order_.get() } {
+}
+auto ItemsView::operator[](size_t const index) const noexcept -> Item const& {
+	return (*items_)[(*item_order_)[index]];
+}
+auto ItemsView::size() const noexcept -> size_t {
+	return item_order_->size();
+}
+auto ItemsView::empty() const noexcept -> bool {
+	return item_order_->empty();
+}
+auto ItemsView::begin() const noexcept -> Iterator {
+	return Iterator{ *items_, item_order_->data() };
+}
+auto ItemsView::end() const noexcept -> Iterator {
+	return Iterator{ *items_, item_order_->data() + item_order_->size() };
+}
+auto ItemsView::toItems() const -> Items {
+	return Items(begin(), end());
+}
+auto operator==(ItemsView const& a, ItemsView const& b) -> bool {
+	return std::equal(a.begin(), a.end(), b.begin(), b.end());
+}
+auto operator==(ItemsView const& a, Items const& b) -> bool {
+	return std::equal(a.begin(), a.end(), b.begin(), b.end());
+}
+
+auto VotingRound::RankBased::create(ItemOrder const& item_order) -> std::optional<VotingRound::RankBased> {
+	if (item_order.empty()) {
+		return std::nullopt;
+	}
 	VotingRound::RankBased rank_based{};
 	rank_based.number_of_sorted_items_ = 1;
 	rank_based.end_index_ = rank_based.number_of_sorted_items_;
+	rank_based.sortFrom(item_order);
 	return rank_based;
 }
-void VotingRound::RankBased::vote(Items& items, Option option) {
+void VotingRound::RankBased::sortFrom(ItemOrder const& item_order) {
+	// Treat the first items of the given order as sorted, in their given order.
+	// The previous search states refer to the old order, so they can't be undone.
+	sorted_items_.clear();
+	history_.clear();
+	for (uint32_t i = 0; i < number_of_sorted_items_; i++) {
+		sorted_items_.insert(i, item_order[i]);
+	}
+}
+void VotingRound::RankBased::vote(ItemOrder const& item_order, Option option) {
+	history_.push_back({ start_index_, end_index_, kNoInsertion });
+
 	uint32_t const mid_index = (start_index_ + end_index_) / 2;
 	if (option == Option::A) {
 		start_index_ = mid_index + 1;
@@ -238,102 +390,27 @@ void VotingRound::RankBased::vote(Items& items, Option option) {
 		return;
 	}
 	uint32_t const insertion_index = start_index_;
-	Item const item_to_insert = items[number_of_sorted_items_];
-
-	// Move each item in [insertion_index, number_of_sorted_items_) one position down the vector
-	for (size_t i = number_of_sorted_items_; i > insertion_index; i--) {
-		items[i] = items[i - 1];
-	}
+	history_.back().insertion_index = insertion_index;
 
-	items[insertion_index] = item_to_insert;
+	sorted_items_.insert(insertion_index, item_order[number_of_sorted_items_]);
 	number_of_sorted_items_++;
 	start_index_ = 0;
 	end_index_ = number_of_sorted_items_;
 }
-auto VotingRound::RankBased::undoVote(Items& items, Votes const& votes) -> bool {
-	if (number_of_sorted_items_ == 1 || votes.empty()) {
+auto VotingRound::RankBased::undoVote() -> bool {
+	if (history_.empty()) {
 		return false;
 	}
-	// Check if the latest vote resulted in inserting an item
-	if (start_index_ == 0 && end_index_ == number_of_sorted_items_) {
-		// Check votes in reverse to find the first vote containing the previously inserted item.
-		// From that first vote, the succeeding votes will be used to recreate start- and end index
-		// up until right before the latest vote was performed.
-		auto const previously_inserted_item_index = votes.back().b_idx;
-		auto previously_inserted_item_first_vote_index = 0ui32;
-		for (int32_t vote_index = votes.size() - 1; vote_index >= 0; vote_index--) {
-			if (votes[vote_index].b_idx != previously_inserted_item_index) {
-				previously_inserted_item_first_vote_index = vote_index + 1;
-				break;
-			}
-		}
+	SearchState const previous_state = history_.back();
+	history_.pop_back();
 
-		// Reset internal state to what it was at the first vote containing the previously inserted item
+	// Remove the item the vote inserted, if any. It's still next in the shuffled order.
+	if (previous_state.insertion_index != kNoInsertion) {
+		sorted_items_.erase(previous_state.insertion_index);
 		number_of_sorted_items_--;
-		start_index_ = 0;
-		end_index_ = number_of_sorted_items_;
-
-		// Simulate voting to set the start- and end indices correctly
-		for (uint32_t vote_index = previously_inserted_item_first_vote_index; vote_index < votes.size() - 1; vote_index++) {
-			uint32_t const mid_index = (start_index_ + end_index_) / 2;
-			if (votes[vote_index].winner == Option::A) {
-				start_index_ = mid_index + 1;
-			}
-			else {
-				end_index_ = mid_index;
-			}
-		}
-
-		// Determine the index where the item was inserted.
-		// Start index should now be equal to end index
-		uint32_t const mid_index = (start_index_ + end_index_) / 2;
-		// if (votes[votes.size() - 1].winner == Option::A) {
-		// 	start_index_ = mid_index + 1;
-		// }
-		// else {
-		// 	end_index_ = mid_index;
-		// }
-		uint32_t const insertion_index = mid_index + (votes.back().winner == Option::A ? 1 : 0);
-
-		// Move each sorted item starting at the insertion index back one position,
-		// and move the previously inserted item to right outside the sorted items
-		Item const previously_inserted_item = items[insertion_index];
-		for (uint32_t item_index = insertion_index; item_index < number_of_sorted_items_; item_index++) {
-			items[item_index] = items[item_index + 1];
-		}
-		items[number_of_sorted_items_] = previously_inserted_item;
-
-		// Start index and end index should now have the correct values
-
-		return true;
-	}
-
-	// Check votes in reverse to find the first vote containing the previously inserted item.
-	// From that first vote, the succeeding votes will be used to recreate start- and end index
-	// up until right before the latest vote was performed.
-	auto const previously_inserted_item_index = votes.back().b_idx;
-	auto previously_inserted_item_first_vote_index = 0ui32;
-	for (int32_t vote_index = votes.size() - 1; vote_index >= 0; vote_index--) {
-		if (votes[vote_index].b_idx != previously_inserted_item_index) {
-			previously_inserted_item_first_vote_index = vote_index + 1;
-			break;
-		}
-	}
-
-	// Reset internal state to what it was at the first vote containing the previously inserted item
-	start_index_ = 0;
-	end_index_ = number_of_sorted_items_;
-
-	// Simulate voting to set the start- and end indices correctly
-	for (uint32_t vote_index = previously_inserted_item_first_vote_index; vote_index < votes.size() - 1; vote_index++) {
-		uint32_t const mid_index = (start_index_ + end_index_) / 2;
-		if (votes[vote_index].winner == Option::A) {
-			start_index_ = mid_index + 1;
-		}
-		else {
-			end_index_ = mid_index;
-		}
 	}
+	start_index_ = previous_state.start_index;
+	end_index_ = previous_state.end_index;
 	return true;
 }
 auto VotingRound::RankBased::currentIndexPair() const noexcept -> IndexPair {
@@ -343,25 +420,74 @@ auto VotingRound::RankBased::currentIndexPair() const noexcept -> IndexPair {
 auto VotingRound::RankBased::numberOfSortedItems() const noexcept -> uint32_t {
 	return number_of_sorted_items_;
 }
+auto VotingRound::RankBased::itemIndex(ItemOrder const& item_order, Index const position) const noexcept -> Index {
+	if (position < number_of_sorted_items_) {
+		return sorted_items_.at(position);
+	}
+	return item_order[position];
+}
+auto VotingRound::RankBased::itemOrder(ItemOrder const& item_order) const -> ItemOrder {
+	ItemOrder ranked_item_order = sorted_items_.toVector();
+	ranked_item_order.insert(ranked_item_order.end(), item_order.begin() + number_of_sorted_items_, item_order.end());
+	return ranked_item_order;
+}
+
+VotingRound::VotingRound(VotingRound const& other)
+	: score_based_{ other.score_based_ }
+	, rank_based_{ other.rank_based_ }
+	, merge_insertion_{ other.merge_insertion_ }
+	, adaptive_ranking_{ other.adaptive_ranking_ }
+	, original_items_order_{ other.original_items_order_ }
+	, item_order_{ other.item_order_ }
+	, seed_{ other.seed_ }
+	, pair_order_{ other.pair_order_ }
+	, adaptive_rating_deviation_{ other.adaptive_rating_deviation_ }
+	, votes_{ other.votes_ }
+	, wins_{ other.wins_ }
+	, losses_{ other.losses_ }
+	, is_saved_{ other.is_saved_ }
+	, voting_format_{ other.voting_format_ }
+	, encoding_{ other.encoding_ } {
+}
+auto VotingRound::operator=(VotingRound const& other) -> VotingRound& {
+	if (this != &other) {
+		*this = VotingRound{ other };
+	}
+	return *this;
+}
 
-auto VotingRound::create(Items const& items, VotingFormat voting_format, Seed seed) -> std::optional<VotingRound> {
+auto VotingRound::create(Items const& items, VotingFormat voting_format, Seed seed, double adaptive_rating_deviation) -> std::optional<VotingRound> {
+	ScopedTimer const timer{ "VotingRound::create" };
 	if (items.size() < 2) {
 		printError("Can't generate voting round: Fewer than two items");
 		return std::nullopt;
 	}
+	if (items.size() - 1 > kMaxVoteIndex) {
+		printError("Can't generate voting round: Too many items");
+		return std::nullopt;
+	}
 	for (auto const& item : items) {
 		if (item.empty() || item == "") {
 			printError("Can't generate voting round: Items are empty");
 			return std::nullopt;
 		}
 	}
+	if (!AdaptiveRanking::isValidRatingDeviation(adaptive_rating_deviation)) {
+		printError("Can't generate voting round: Rating deviation must be positive");
+		return std::nullopt;
+	}
 	VotingRound voting_round{};
 
 	// Retain item order, to make seeded item shuffling deterministic
 	voting_round.original_items_order_ = items;
-	voting_round.items_ = items;
+	voting_round.item_order_.resize(items.size());
+	std::iota(voting_round.item_order_.begin(), voting_round.item_order_.end(), 0);
+	voting_round.wins_.resize(items.size(), 0);
+	voting_round.losses_.resize(items.size(), 0);
 	voting_round.seed_ = (seed == 0 ? generateSeed() : seed);
 	voting_round.voting_format_ = voting_format;
+	voting_round.pair_order_ = newPairOrder(items.size(), voting_format);
+	voting_round.adaptive_rating_deviation_ = adaptive_rating_deviation;
 
 	if (!voting_round.createFormatImpl()) {
 		return std::nullopt;
@@ -370,6 +496,41 @@ auto VotingRound::create(Items const& items, VotingFormat voting_format, Seed se
 	return voting_round;
 }
 auto VotingRound::create(std::vector<std::string> const& lines) -> std::optional<VotingRound> {
+	return createFromLines(Lines{ lines.begin(), lines.end() });
+}
+auto VotingRound::create(MappedFile const& file) -> std::optional<VotingRound> {
+	if (isBinaryVotingRound(file.data())) {
+		return createFromBinary(file.data());
+	}
+	return createFromLines(file.lines());
+}
+auto VotingRound::load(std::string const& file_name) -> std::optional<VotingRound> {
+	auto const records = VoteJournal::leftoverRecords(file_name);
+	std::optional<VotingRound> voting_round{};
+	{
+		auto const file = MappedFile::open(file_name);
+		if (!file.has_value()) {
+			return std::nullopt;
+		}
+		// Only text files are journaled
+		if (records.empty() || isBinaryVotingRound(file.value().data())) {
+			return create(file.value());
+		}
+		Lines lines = file.value().lines();
+		lines.insert(lines.end(), records.begin(), records.end());
+		voting_round = createFromLines(lines);
+	}
+	if (!voting_round.has_value()) {
+		printError("Could not recover the votes left in " + file_name + std::string{ kJournalFileSuffix });
+		return std::nullopt;
+	}
+
+	// The file is appended to once it's no longer mapped. If that fails, the votes are saved with the round.
+	voting_round.value().is_saved_ = VoteJournal::recover(file_name, records);
+	return voting_round;
+}
+auto VotingRound::createFromLines(Lines const& lines) -> std::optional<VotingRound> {
+	ScopedTimer const timer{ "VotingRound::createFromLines" };
 	VotingRound voting_round{};
 	size_t line_index = 0;
 
@@ -378,19 +539,11 @@ auto VotingRound::create(std::vector<std::string> const& lines) -> std::optional
 		if (lines[line_index].empty()) {
 			break;
 		}
-		voting_round.items_.emplace_back(lines[line_index]);
+		voting_round.original_items_order_.emplace_back(lines[line_index]);
 	}
-	if (voting_round.items().size() < 2) {
-		printError("Parsed items are fewer than two");
+	if (!loadedItemsAreValid(voting_round.original_items_order_)) {
 		return std::nullopt;
 	}
-	if (!itemsAreUnique(voting_round.items())) {
-		printError("Parsed items are not unique");
-		return std::nullopt;
-	}
-
-	// Retain item order, to make seeded item shuffling deterministic
-	voting_round.original_items_order_ = voting_round.items();
 
 	// Skip empty line
 	line_index++;
@@ -415,56 +568,228 @@ auto VotingRound::create(std::vector<std::string> const& lines) -> std::optional
 
 	voting_round.voting_format_ = stringToVotingFormat(lines[line_index]);
 	if (voting_round.format() == VotingFormat::Invalid) {
-		printError("Incorrect voting format: " + lines[line_index]);
+		printError("Incorrect voting format: " + std::string{ lines[line_index] });
 		return std::nullopt;
 	}
 	line_index++;
 
-	// Load votes
+	// Load pair order, which is only written for permuted rounds
+	if (line_index < lines.size() && lines[line_index] == kPermutedPairsMarker) {
+		if (voting_round.format() != VotingFormat::Full) {
+			printError("Only full voting rounds can have permuted pairs");
+			return std::nullopt;
+		}
+		voting_round.pair_order_ = PairOrder::Permuted;
+		line_index++;
+	}
+
+	// Load rating deviation, which is only written for adaptive rounds
+	if (line_index < lines.size() && lines[line_index].starts_with(kRatingDeviationPrefix)) {
+		if (voting_round.format() != VotingFormat::Adaptive) {
+			printError("Only adaptive voting rounds have a rating deviation");
+			return std::nullopt;
+		}
+		auto const rating_deviation = parseDecimal(lines[line_index].substr(kRatingDeviationPrefix.size()));
+		if (!rating_deviation.has_value() || !AdaptiveRanking::isValidRatingDeviation(rating_deviation.value())) {
+			printError("Invalid rating deviation");
+			return std::nullopt;
+		}
+		voting_round.adaptive_rating_deviation_ = rating_deviation.value();
+		line_index++;
+	}
+
+	// Load votes, replaying any undone votes appended by a journal
 	for (; line_index < lines.size(); line_index++) {
+		if (lines[line_index] == kUndoRecord) {
+			if (voting_round.votes().empty()) {
+				printError("Undo record without votes to undo");
+				return std::nullopt;
+			}
+			voting_round.votes_.popBack();
+			continue;
+		}
 		auto const vote = parseVote(lines[line_index]);
 		if (vote.a_idx == 0 && vote.b_idx == 0) {
 			printError("Failed to parse vote");
 			return std::nullopt;
 		}
-		voting_round.votes_.emplace_back(vote);
+		voting_round.votes_.append(vote);
 	}
-	if (!votingIndicesAreSmallerThanNumberOfItems(voting_round.votes(), voting_round.items().size())) {
-		printError("Some parsed indices in vote are larger than allowed");
+
+	if (!voting_round.finishLoading()) {
 		return std::nullopt;
 	}
+	return voting_round;
+}
+auto VotingRound::createFromBinary(std::string_view const data) -> std::optional<VotingRound> {
+	ScopedTimer const timer{ "VotingRound::createFromBinary" };
+	BinaryReader reader{ data };
 
-	if (hasDuplicateMatchups(voting_round.votes())) {
-		printError("Some vote matchups are duplicated");
+	// Header
+	auto const magic = reader.readBytes(kBinaryMagic.size());
+	if (!magic.has_value() || magic.value() != kBinaryMagic) {
+		printError("Not a binary voting round file");
+		return std::nullopt;
+	}
+	auto const version = reader.readByte();
+	if (!version.has_value() || version.value() < kFirstBinaryVersion || version.value() > kBinaryVersion) {
+		printError("Unsupported binary voting round version");
 		return std::nullopt;
 	}
 
-	if (!voting_round.createFormatImpl()) {
+	VotingRound voting_round{};
+	voting_round.encoding_ = VotingRoundEncoding::Binary;
+
+	// Load items
+	auto const number_of_items = reader.readVarint();
+	if (!number_of_items.has_value() || number_of_items.value() > data.size()) {
+		printError("Invalid number of items");
+		return std::nullopt;
+	}
+	voting_round.original_items_order_.reserve(static_cast<size_t>(number_of_items.value()));
+	for (uint64_t i = 0; i < number_of_items.value(); i++) {
+		auto const item = reader.readString();
+		if (!item.has_value() || item.value().empty()) {
+			printError("Could not load item " + std::to_string(i));
+			return std::nullopt;
+		}
+		voting_round.original_items_order_.emplace_back(item.value());
+	}
+	if (!loadedItemsAreValid(voting_round.original_items_order_)) {
+		return std::nullopt;
+	}
+
+	// Load seed and voting format
+	auto const seed = reader.readVarint();
+	if (!seed.has_value() || seed.value() > std::numeric_limits<Seed>::max()) {
+		printError("Invalid seed");
+		return std::nullopt;
+	}
+	voting_round.seed_ = static_cast<Seed>(seed.value());
+
+	auto const voting_format = reader.readByte();
+	if (!voting_format.has_value()) {
+		printError("Voting format missing");
+		return std::nullopt;
+	}
+	voting_round.voting_format_ = static_cast<VotingFormat>(voting_format.value());
+	if (votingFormatToString(voting_round.format()).empty()) {
+		printError("Incorrect voting format: " + std::to_string(voting_format.value()));
 		return std::nullopt;
 	}
+	if (version.value() > kFirstBinaryVersion) {
+		auto const pair_order = reader.readByte();
+		if (!pair_order.has_value() || pair_order.value() > to_underlying(PairOrder::Permuted)) {
+			printError("Invalid pair order");
+			return std::nullopt;
+		}
+		voting_round.pair_order_ = static_cast<PairOrder>(pair_order.value());
+		if (voting_round.pair_order_ == PairOrder::Permuted && voting_round.format() != VotingFormat::Full) {
+			printError("Only full voting rounds can have permuted pairs");
+			return std::nullopt;
+		}
+	}
+	if (version.value() > 2 && voting_round.format() == VotingFormat::Adaptive) {
+		auto const rating_deviation = reader.readVarint();
+		if (!rating_deviation.has_value() || !AdaptiveRanking::isValidRatingDeviation(std::bit_cast<double>(rating_deviation.value()))) {
+			printError("Invalid rating deviation");
+			return std::nullopt;
+		}
+		voting_round.adaptive_rating_deviation_ = std::bit_cast<double>(rating_deviation.value());
+	}
 
-	switch (voting_round.format()) {
+	// Load votes, each stored as index A followed by index B with the winner in its lowest bit
+	auto const number_of_votes = reader.readVarint();
+	if (!number_of_votes.has_value() || number_of_votes.value() > data.size()) {
+		printError("Invalid number of votes");
+		return std::nullopt;
+	}
+	voting_round.votes_.reserve(static_cast<size_t>(number_of_votes.value()));
+	for (uint64_t i = 0; i < number_of_votes.value(); i++) {
+		auto const a_idx_value = reader.readVarint();
+		auto const b_idx_and_winner = reader.readVarint();
+		auto const a_idx = (a_idx_value.has_value() ? toVoteIndex(a_idx_value.value()) : std::nullopt);
+		auto const b_idx = (b_idx_and_winner.has_value() ? toVoteIndex(b_idx_and_winner.value() >> 1) : std::nullopt);
+		if (!a_idx.has_value() || !b_idx.has_value()) {
+			printError("Failed to parse vote");
+			return std::nullopt;
+		}
+		voting_round.votes_.append({
+			a_idx.value(),
+			b_idx.value(),
+			static_cast<Option>(b_idx_and_winner.value() & 1) });
+	}
+	if (!reader.atEnd()) {
+		printError("Unexpected data after votes");
+		return std::nullopt;
+	}
+
+	if (!voting_round.finishLoading()) {
+		return std::nullopt;
+	}
+	return voting_round;
+}
+auto VotingRound::finishLoading() -> bool {
+	// Start from the original item order, to make seeded item shuffling deterministic
+	item_order_.resize(original_items_order_.size());
+	std::iota(item_order_.begin(), item_order_.end(), 0);
+
+	if (!votingIndicesAreSmallerThanNumberOfItems(votes_, static_cast<uint32_t>(item_order_.size()))) {
+		printError("Some parsed indices in vote are larger than allowed");
+		return false;
+	}
+
+	if (hasMatchupsAgainstSameItem(votes_)) {
+		printError("Some vote matchups are against the same item");
+		return false;
+	}
+
+	if (hasDuplicateMatchups(static_cast<uint32_t>(item_order_.size()), votes_)) {
+		printError("Some vote matchups are duplicated");
+		return false;
+	}
+
+	if (!createFormatImpl()) {
+		return false;
+	}
+
+	switch (voting_format_) {
 	case VotingFormat::Full:
 	case VotingFormat::Reduced:
-		if (voting_round.votes().size() > voting_round.numberOfScheduledVotes()) {
+		if (votes_.size() > numberOfScheduledVotes()) {
 			printError("Too many votes parsed. Voting round is invalidated");
-			return std::nullopt;
+			return false;
 		}
 		break;
 	case VotingFormat::Ranked:
+	case VotingFormat::MergeInsertion:
+	case VotingFormat::Adaptive:
 	case VotingFormat::Invalid:
 	default:
 		break;
 	}
 
-	voting_round.shuffle();
+	shuffle();
+
+	auto counts = countWinsAndLosses(votes_, item_order_.size());
+	wins_ = std::move(counts.wins);
+	losses_ = std::move(counts.losses);
 
-	switch (voting_round.format()) {
+	switch (voting_format_) {
 	case VotingFormat::Ranked:
-		for (auto const& vote : voting_round.votes()) {
-			voting_round.rank_based_.value().vote(voting_round.items_, vote.winner);
+		for (Vote const vote : votes_) {
+			rank_based_.value().vote(item_order_, vote.winner);
 		}
 		break;
+	case VotingFormat::MergeInsertion:
+		if (!merge_insertion_.value().replay(votes_)) {
+			printError("Parsed votes don't match the merge-insertion matchups. Voting round is invalidated");
+			return false;
+		}
+		break;
+	case VotingFormat::Adaptive:
+		adaptive_ranking_.value().replay(votes_);
+		break;
 	case VotingFormat::Full:
 	case VotingFormat::Reduced:
 	case VotingFormat::Invalid:
@@ -472,12 +797,15 @@ auto VotingRound::create(std::vector<std::string> const& lines) -> std::optional
 		break;
 	}
 
-	voting_round.is_saved_ = true;
-	return voting_round;
+	is_saved_ = true;
+	return true;
 }
 auto VotingRound::shuffle() -> bool {
+	if (voting_format_ == VotingFormat::Ranked && rank_based_.has_value()) {
+		item_order_ = rank_based_.value().itemOrder(item_order_);
+	}
 	std::default_random_engine random_engine(seed_);
-	std::shuffle(items_.begin(), items_.end(), random_engine);
+	std::shuffle(item_order_.begin(), item_order_.end(), random_engine);
 	return shuffleImpl();
 }
 auto VotingRound::vote(Option option) -> bool {
@@ -485,8 +813,13 @@ auto VotingRound::vote(Option option) -> bool {
 		return false;
 	}
 	auto const index_pair = currentIndexPairImpl();
-	votes_.emplace_back(index_pair.first, index_pair.second, option);
+	votes_.append({ index_pair.first, index_pair.second, option });
+	addToTally(votes_.back());
 	voteImpl(option);
+	// A failed append is remembered by the journal, and the next save rewrites the file
+	if (journal_ && !journal_->appendVote(votes_.back())) {
+		printError("Vote will be saved when the voting round is saved again");
+	}
 	is_saved_ = false;
 	return true;
 }
@@ -500,19 +833,82 @@ auto VotingRound::undoVote() -> bool {
 		return false;
 	}
 
-	votes_.pop_back();
+	removeFromTally(votes_.back());
+	votes_.popBack();
+	if (journal_ && !journal_->appendUndo()) {
+		printError("Undo will be saved when the voting round is saved again");
+	}
 	is_saved_ = false;
 	return true;
 }
 auto VotingRound::save(std::string const& file_name) -> bool {
-	if (!saveFile(file_name, convertToText())) {
+	ScopedTimer const timer{ "VotingRound::save" };
+	if (journal_ && journal_->fileName() == file_name) {
+		if (journal_->save()) {
+			is_saved_ = true;
+			return true;
+		}
+		// Records were lost, so the file is rewritten from the round and journaled anew
+		uint32_t const sync_interval = journal_->syncInterval();
+		stopJournal();
+		return startJournal(file_name, sync_interval);
+	}
+
+	bool const saved = (encoding_ == VotingRoundEncoding::Binary ?
+		saveBinaryFile(file_name, convertToBinary()) :
+		saveFile(file_name, convertToText()));
+	if (!saved) {
 		return false;
 	}
 	is_saved_ = true;
 	return true;
 }
-auto VotingRound::items() const noexcept -> Items const& {
-	return items_;
+auto VotingRound::startJournal(std::string const& file_name, uint32_t const sync_interval) -> bool {
+	if (journal_ && journal_->fileName() == file_name) {
+		return save(file_name);
+	}
+	stopJournal();
+	if (encoding_ == VotingRoundEncoding::Text && !VoteJournal::leftoverRecords(file_name).empty()) {
+		printError("Votes left in " + file_name + std::string{ kJournalFileSuffix } + " haven't been recovered. Load '" + file_name + "' to recover them.");
+		return false;
+	}
+	if (!save(file_name)) {
+		return false;
+	}
+	if (encoding_ == VotingRoundEncoding::Text) {
+		journal_ = VoteJournal::open(file_name, sync_interval);
+	}
+	return true;
+}
+void VotingRound::stopJournal() {
+	journal_.reset();
+}
+auto VotingRound::isJournaling() const noexcept -> bool {
+	return journal_ != nullptr;
+}
+void VotingRound::setEncoding(VotingRoundEncoding const encoding) noexcept {
+	if (encoding != VotingRoundEncoding::Text) {
+		stopJournal();
+	}
+	if (encoding != encoding_) {
+		is_saved_ = false;
+	}
+	encoding_ = encoding;
+}
+auto VotingRound::items() const -> ItemsView {
+	// Ranked orders are computed for each view, so earlier views keep the order they were created with
+	if (voting_format_ == VotingFormat::Ranked && rank_based_.has_value()) {
+		return ItemsView{ original_items_order_, rank_based_.value().itemOrder(item_order_) };
+	}
+	if (voting_format_ == VotingFormat::MergeInsertion && merge_insertion_.has_value() && merge_insertion_.value().isSorted()) {
+		// Sorted positions refer to the shuffled item order
+		return ItemsView{ original_items_order_, positionsToItemOrder(item_order_, merge_insertion_.value().sortedOrder()) };
+	}
+	if (voting_format_ == VotingFormat::Adaptive && adaptive_ranking_.has_value()) {
+		// Ranked positions refer to the shuffled item order
+		return ItemsView{ original_items_order_, positionsToItemOrder(item_order_, adaptive_ranking_.value().rankedOrder()) };
+	}
+	return ItemsView{ original_items_order_, item_order_ };
 }
 auto VotingRound::originalItemOrder() const noexcept -> Items const& {
 	return original_items_order_;
@@ -523,12 +919,32 @@ auto VotingRound::format() const noexcept -> VotingFormat {
 auto VotingRound::seed() const noexcept -> Seed {
 	return seed_;
 }
-auto VotingRound::votes() const noexcept -> Votes const& {
+auto VotingRound::pairOrder() const noexcept -> PairOrder {
+	return pair_order_;
+}
+auto VotingRound::adaptiveRatingDeviation() const noexcept -> double {
+	return adaptive_rating_deviation_;
+}
+auto VotingRound::votes() const noexcept -> VoteLog const& {
 	return votes_;
 }
 auto VotingRound::isSaved() const noexcept -> bool {
 	return is_saved_;
 }
+auto VotingRound::encoding() const noexcept -> VotingRoundEncoding {
+	return encoding_;
+}
+auto VotingRound::scores() const -> Scores {
+	auto const strengths = WinMatrix::create(item_order_.size(), votes_).fitStrengths();
+	Scores scores{};
+	for (size_t i = 0; i < item_order_.size(); i++) {
+		if (wins_[i] == 0 && losses_[i] == 0) {
+			continue;
+		}
+		scores.emplace_back(item(static_cast<Index>(i)), wins_[i], losses_[i], strengths[i]);
+	}
+	return scores;
+}
 // TODO: Deprecated in favor of VotingRound::create().
 // Either move some of these into VotingRound::create(), or call this from within it.
 // auto VotingRound::verify() const -> bool {
@@ -546,10 +962,6 @@ auto VotingRound::isSaved() const noexcept -> bool {
 // 		printError("Scheduled votes are invalid");
 // 		return false;
 // 	}
-// 	if (hasDuplicateScheduledVotes(index_pairs_)) {
-// 		printError("Scheduled votes have duplicates");
-// 		return false;
-// 	}
 // 	if (seed_ == 0) {
 // 		printError("Seed is 0");
 // 		return false;
@@ -592,7 +1004,7 @@ auto VotingRound::currentMatchup() const -> std::optional<Matchup> {
 	if (index_pair == IndexPair{ 0, 0 }) {
 		return std::nullopt;
 	}
-	return Matchup{ items_[index_pair.first], items_[index_pair.second] };
+	return Matchup{ item(index_pair.first), item(index_pair.second) };
 }
 auto VotingRound::currentVotingLine() const -> std::optional<std::string> {
 	if (!hasRemainingVotes()) {
@@ -605,7 +1017,7 @@ auto VotingRound::currentVotingLine() const -> std::optional<std::string> {
 		return std::nullopt;
 	}
 
-	auto const max_length = findMaxLength(items_);
+	auto const max_length = findMaxLength(original_items_order_);
 	auto const length_a = matchup.value().item_a.size();
 	auto const length_b = matchup.value().item_b.size();
 	auto const padding_length_a = max_length - length_a;
@@ -623,7 +1035,7 @@ auto VotingRound::convertToText() const -> std::vector<std::string> {
 
 	// Original item order, to make seeded item shuffling deterministic
 	if (original_items_order_.empty() ||
-		items_.empty()) {
+		item_order_.empty()) {
 		printError("Failed to generate voting file data: No items");
 		return lines;
 	}
@@ -637,15 +1049,60 @@ auto VotingRound::convertToText() const -> std::vector<std::string> {
 	// Seed
 	lines.emplace_back(std::to_string(seed_));
 
-	// Voting format
+	// Voting format, and pair order if it isn't the one every earlier file has
 	lines.emplace_back(votingFormatToString(voting_format_));
+	if (pair_order_ == PairOrder::Permuted) {
+		lines.emplace_back(kPermutedPairsMarker);
+	}
+
+	// Rating deviation, written with the fewest digits that read back as the same value
+	if (voting_format_ == VotingFormat::Adaptive) {
+		std::array<char, 32> rating_deviation{};
+		auto const end = std::to_chars(rating_deviation.data(), rating_deviation.data() + rating_deviation.size(), adaptive_rating_deviation_).ptr;
+		lines.emplace_back(std::string{ kRatingDeviationPrefix } + std::string{ rating_deviation.data(), end });
+	}
 
 	// Votes
-	for (Vote const& vote : votes_) {
-		lines.emplace_back(std::to_string(vote.a_idx) + " " + std::to_string(vote.b_idx) + " " + std::to_string(to_underlying(vote.winner)));
+	for (Vote const vote : votes_) {
+		lines.emplace_back(voteRecord(vote));
 	}
 	return lines;
 }
+auto VotingRound::convertToBinary() const -> std::string {
+	if (original_items_order_.empty() ||
+		item_order_.empty()) {
+		printError("Failed to generate voting file data: No items");
+		return {};
+	}
+
+	BinaryWriter writer{};
+
+	// Header
+	writer.writeBytes(kBinaryMagic);
+	writer.writeByte(kBinaryVersion);
+
+	// Original item order, to make seeded item shuffling deterministic
+	writer.writeVarint(original_items_order_.size());
+	for (Item const& item : original_items_order_) {
+		writer.writeString(item);
+	}
+
+	// Seed, voting format and pair order, and the rating deviation of adaptive rounds
+	writer.writeVarint(seed_);
+	writer.writeByte(static_cast<uint8_t>(to_underlying(voting_format_)));
+	writer.writeByte(static_cast<uint8_t>(to_underlying(pair_order_)));
+	if (voting_format_ == VotingFormat::Adaptive) {
+		writer.writeVarint(std::bit_cast<uint64_t>(adaptive_rating_deviation_));
+	}
+
+	// Votes, with the winner in the lowest bit of index B
+	writer.writeVarint(votes_.size());
+	for (Vote const vote : votes_) {
+		writer.writeVarint(vote.a_idx);
+		writer.writeVarint((static_cast<uint64_t>(vote.b_idx) << 1) | to_underlying(vote.winner));
+	}
+	return writer.data();
+}
 
 auto VotingRound::counterStringImpl() const -> std::string {
 	switch (voting_format_) {
@@ -653,7 +1110,12 @@ auto VotingRound::counterStringImpl() const -> std::string {
 	case VotingFormat::Reduced:
 		return counterString(votes_.size() + 1, numberOfScheduledVotes());
 	case VotingFormat::Ranked:
-		return counterString(votes_.size() + 1, '~' + std::to_string(static_cast<uint32_t>(items_.size() * std::log2(items_.size()))));
+		return counterString(votes_.size() + 1, '~' + std::to_string(static_cast<uint32_t>(item_order_.size() * std::log2(item_order_.size()))));
+	case VotingFormat::MergeInsertion:
+		// An exact maximum rather than an estimate, like the format menu's "At most"
+		return counterString(votes_.size() + 1, MergeInsertion::maximumNumberOfVotes(static_cast<uint32_t>(item_order_.size())));
+	case VotingFormat::Adaptive:
+		return counterString(votes_.size() + 1, '~' + std::to_string(AdaptiveRanking::estimatedNumberOfVotes(static_cast<uint32_t>(item_order_.size()), adaptive_rating_deviation_)));
 	case VotingFormat::Invalid:
 	default:
 		return {};
@@ -668,7 +1130,18 @@ auto VotingRound::voteImpl(Option option) -> bool {
 		if (!rank_based_.has_value()) {
 			return false;
 		}
-		rank_based_.value().vote(items_, option);
+		rank_based_.value().vote(item_order_, option);
+		return true;
+	case VotingFormat::MergeInsertion:
+		if (!merge_insertion_.has_value()) {
+			return false;
+		}
+		return merge_insertion_.value().vote(option);
+	case VotingFormat::Adaptive:
+		if (!adaptive_ranking_.has_value()) {
+			return false;
+		}
+		adaptive_ranking_.value().vote(votes_.back());
 		return true;
 	case VotingFormat::Invalid:
 	default:
@@ -684,7 +1157,17 @@ auto VotingRound::undoVoteImpl() -> bool {
 		if (!rank_based_.has_value()) {
 			return false;
 		}
-		return rank_based_.value().undoVote(items_, votes_);
+		return rank_based_.value().undoVote();
+	case VotingFormat::MergeInsertion:
+		if (!merge_insertion_.has_value()) {
+			return false;
+		}
+		return merge_insertion_.value().undoVote();
+	case VotingFormat::Adaptive:
+		if (!adaptive_ranking_.has_value()) {
+			return false;
+		}
+		return adaptive_ranking_.value().undoVote();
 	case VotingFormat::Invalid:
 	default:
 		return false;
@@ -694,11 +1177,17 @@ auto VotingRound::createFormatImpl() -> bool {
 	switch (voting_format_) {
 	case VotingFormat::Full:
 	case VotingFormat::Reduced:
-		score_based_ = ScoreBased::create(static_cast<uint32_t>(items_.size()), voting_format_);
+		score_based_ = ScoreBased::create(static_cast<uint32_t>(item_order_.size()), voting_format_, pair_order_);
 		return score_based_.has_value();
 	case VotingFormat::Ranked:
-		rank_based_ = RankBased::create();
+		rank_based_ = RankBased::create(item_order_);
 		return rank_based_.has_value();
+	case VotingFormat::MergeInsertion:
+		merge_insertion_ = MergeInsertion::create(static_cast<uint32_t>(item_order_.size()));
+		return merge_insertion_.has_value();
+	case VotingFormat::Adaptive:
+		adaptive_ranking_ = AdaptiveRanking::create(static_cast<uint32_t>(item_order_.size()), adaptive_rating_deviation_);
+		return adaptive_ranking_.has_value();
 	case VotingFormat::Invalid:
 	default:
 		return false;
@@ -711,15 +1200,25 @@ auto VotingRound::currentIndexPairImpl() const noexcept -> IndexPair {
 		if (!score_based_.has_value()) {
 			return {};
 		}
-		if (score_based_.value().indexPairs().size() < votes_.size() + 1) {
+		if (score_based_.value().numberOfScheduledVotes() < votes_.size() + 1) {
 			return {};
 		}
-		return score_based_.value().indexPairs()[votes_.size()];
+		return score_based_.value().currentIndexPair(static_cast<uint32_t>(votes_.size()));
 	case VotingFormat::Ranked:
 		if (!rank_based_.has_value()) {
 			return {};
 		}
 		return rank_based_.value().currentIndexPair();
+	case VotingFormat::MergeInsertion:
+		if (!merge_insertion_.has_value()) {
+			return {};
+		}
+		return merge_insertion_.value().currentIndexPair();
+	case VotingFormat::Adaptive:
+		if (!adaptive_ranking_.has_value()) {
+			return {};
+		}
+		return adaptive_ranking_.value().currentIndexPair();
 	case VotingFormat::Invalid:
 	default:
 		return {};
@@ -734,7 +1233,16 @@ auto VotingRound::shuffleImpl() -> bool {
 		}
 		return score_based_.value().shuffle(seed_);
 	case VotingFormat::Ranked:
+		if (!rank_based_.has_value()) {
+			return false;
+		}
+		rank_based_.value().sortFrom(item_order_);
 		return true;
+	case VotingFormat::MergeInsertion:
+		// Votes refer to positions in the shuffled order, so they're still valid
+		return merge_insertion_.has_value();
+	case VotingFormat::Adaptive:
+		return adaptive_ranking_.has_value();
 	case VotingFormat::Invalid:
 	default:
 		return false;
@@ -752,7 +1260,17 @@ auto VotingRound::hasRemainingVotesImpl() const noexcept -> bool {
 		if (!rank_based_.has_value()) {
 			return false;
 		}
-		return rank_based_.value().numberOfSortedItems() < items_.size();
+		return rank_based_.value().numberOfSortedItems() < item_order_.size();
+	case VotingFormat::MergeInsertion:
+		if (!merge_insertion_.has_value()) {
+			return false;
+		}
+		return !merge_insertion_.value().isSorted();
+	case VotingFormat::Adaptive:
+		if (!adaptive_ranking_.has_value()) {
+			return false;
+		}
+		return !adaptive_ranking_.value().isFinished();
 	case VotingFormat::Invalid:
 	default:
 		return false;
@@ -765,6 +1283,17 @@ auto VotingRound::numberOfSortedItemsImpl() const noexcept -> uint32_t {
 			return 0;
 		}
 		return rank_based_.value().numberOfSortedItems();
+	case VotingFormat::MergeInsertion:
+		// Items are only known to be sorted once all of them are
+		if (!merge_insertion_.has_value() || !merge_insertion_.value().isSorted()) {
+			return 0;
+		}
+		return static_cast<uint32_t>(item_order_.size());
+	case VotingFormat::Adaptive:
+		if (!adaptive_ranking_.has_value() || !adaptive_ranking_.value().isFinished()) {
+			return 0;
+		}
+		return static_cast<uint32_t>(item_order_.size());
 	case VotingFormat::Full:
 	case VotingFormat::Reduced:
 	case VotingFormat::Invalid:
@@ -781,8 +1310,36 @@ auto VotingRound::numberOfScheduledVotesImpl() const noexcept -> uint32_t {
 		}
 		return score_based_.value().numberOfScheduledVotes();
 	case VotingFormat::Ranked:
+	case VotingFormat::MergeInsertion:
+	case VotingFormat::Adaptive:
 	case VotingFormat::Invalid:
 	default:
 		return 0;
 	}
 }
+auto VotingRound::item(Index const position) const noexcept -> Item const& {
+	if (voting_format_ == VotingFormat::Ranked && rank_based_.has_value()) {
+		return original_items_order_[rank_based_.value().itemIndex(item_order_, position)];
+	}
+	return original_items_order_[item_order_[position]];
+}
+void VotingRound::addToTally(Vote const& vote) {
+	if (vote.winner == Option::A) {
+		wins_[vote.a_idx]++;
+		losses_[vote.b_idx]++;
+	}
+	else {
+		wins_[vote.b_idx]++;
+		losses_[vote.a_idx]++;
+	}
+}
+void VotingRound::removeFromTally(Vote const& vote) {
+	if (vote.winner == Option::A) {
+		wins_[vote.a_idx]--;
+		losses_[vote.b_idx]--;
+	}
+	else {
+		wins_[vote.b_idx]--;
+		losses_[vote.a_idx]--;
+	}
+}
@@ -1,78 +1,191 @@
 #pragma once
 
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "adaptive_ranking.h"
+#include "constants.h"
+#include "index_pair.h"
+#include "mapped_file.h"
+#include "merge_insertion.h"
+#include "order_statistic_tree.h"
+#include "pair_schedule.h"
+#include "score.h"
 #include "vote.h"
+#include "vote_journal.h"
+#include "vote_log.h"
 #include "voting_format.h"
 
 /* -------------- Items -------------- */
 using Item = std::string;
 using Items = std::vector<Item>;
 
-/* -------------- Seed -------------- */
-using Seed = uint32_t;
+// Order of items as positions into their original order
+using ItemOrder = std::vector<Index>;
+
+// Items in the order of an ItemOrder, without copying them. A view either refers to an order
+// owned elsewhere, and follows it when it changes, such as the round's order when shuffling,
+// or owns an order computed for it, which never changes.
+class ItemsView final {
+public:
+	class Iterator final {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Item;
+		using difference_type = std::ptrdiff_t;
+		using pointer = Item const*;
+		using reference = Item const&;
+
+		Iterator() noexcept = default;
+		Iterator(Items const& items, Index const* position) noexcept;
+
+		auto operator*() const noexcept -> Item const&;
+		auto operator->() const noexcept -> Item const*;
+		auto operator++() noexcept -> Iterator&;
+		auto operator++(int) noexcept -> Iterator;
+		auto operator==(Iterator const& other) const noexcept -> bool;
+	private:
+		Items const* items_{ nullptr };
+		Index const* position_{ nullptr };
+	};
+
+	ItemsView(Items const& items, ItemOrder const& item_order) noexcept;
+	ItemsView(Items const& items, ItemOrder&& item_order);
 
-/* -------------- Index pairs -------------- */
-using Index = uint32_t;
-using IndexPair = std::pair<Index, Index>;
-struct IndexPairHash {
-	uint64_t operator()(IndexPair const& index_pair) const {
-		return (static_cast<uint64_t>(index_pair.first) << 32) + static_cast<uint64_t>(index_pair.second);
-	}
+	auto operator[](size_t const index) const noexcept -> Item const&;
+	auto size() const noexcept -> size_t;
+	auto empty() const noexcept -> bool;
+	auto begin() const noexcept -> Iterator;
+	auto end() const noexcept -> Iterator;
+	auto toItems() const -> Items;
+private:
+	Items const* items_;
+	// Shared, so copying a view doesn't copy its order
+	std::shared_ptr<ItemOrder const> owned_item_order_{};
+	ItemOrder const* item_order_;
 };
-using IndexPairs = std::vector<IndexPair>;
+auto operator==(ItemsView const& a, ItemsView const& b) -> bool;
+auto operator==(ItemsView const& a, Items const& b) -> bool;
+
+/* -------------- Seed -------------- */
+using Seed = uint32_t;
 
+/* -------------- Matchups -------------- */
 struct Matchup {
 	Item item_a{};
 	Item item_b{};
 };
 
+/* -------------- Voting round file -------------- */
+enum class VotingRoundEncoding : uint32_t {
+	Text,
+	Binary,
+};
+
+/* -------------- Pair order -------------- */
+// Order of the pairs in full and reduced rounds. Full rounds with too many pairs to hold in memory
+// are permuted, which their files are marked with. Rounds saved without the mark, including those
+// saved before permuted rounds existed, are shuffled.
+enum class PairOrder : uint32_t {
+	Shuffled,	// Every pair is generated, then shuffled
+	Permuted,	// Each pair is computed on demand from a seeded permutation
+};
+
 /* -------------- Voting round -------------- */
 class VotingRound final {
 	class ScoreBased final {
 	public:
-		static auto create(uint32_t const number_of_items, VotingFormat const voting_format) -> std::optional<ScoreBased>;
+		static auto create(uint32_t const number_of_items, VotingFormat const voting_format, PairOrder const pair_order) -> std::optional<ScoreBased>;
 
 		auto shuffle(Seed const seed) -> bool;
 		auto currentIndexPair(uint32_t const counter) const -> IndexPair;
-		auto indexPairs() const noexcept -> IndexPairs const&;
 		auto numberOfScheduledVotes() const noexcept -> uint32_t;
 	private:
+		// Permuted rounds compute each pair on demand instead
 		IndexPairs index_pairs_{};
+		std::optional<PairSchedule> pair_schedule_{};
 	};
+	// The sorted items are kept in an order-statistic tree, so that inserting an item is O(log N).
+	// Unsorted items stay in their shuffled order, in which they are inserted one at a time.
 	class RankBased final {
 	public:
-		static auto create() -> std::optional<RankBased>;
+		static auto create(ItemOrder const& item_order) -> std::optional<RankBased>;
 
-		void vote(Items& items, Option option);
-		auto undoVote(Items& items, Votes const& votes) -> bool;
+		void sortFrom(ItemOrder const& item_order);
+		void vote(ItemOrder const& item_order, Option option);
+		auto undoVote() -> bool;
 		auto currentIndexPair() const noexcept -> IndexPair;
 		auto numberOfSortedItems() const noexcept -> uint32_t;
+		auto itemIndex(ItemOrder const& item_order, Index const position) const noexcept -> Index;
+		auto itemOrder(ItemOrder const& item_order) const -> ItemOrder;
 	private:
+		// Search state replaced by each vote, and where the vote inserted an item if it did
+		struct SearchState {
+			uint32_t start_index{};
+			uint32_t end_index{};
+			uint32_t insertion_index{};
+		};
+		static constexpr uint32_t kNoInsertion = std::numeric_limits<uint32_t>::max();
+
+		OrderStatisticTree sorted_items_{};
+		std::vector<SearchState> history_{};
 		uint32_t number_of_sorted_items_{ 1 };
 		uint32_t start_index_{ 0 };
 		uint32_t end_index_{ 1 };
 	};
 public:
-
-	static auto create(Items const& items, VotingFormat voting_format, Seed seed = 0) -> std::optional<VotingRound>;
+	VotingRound() = default;
+	// Copies start without a journal, so that only one round appends to a file
+	VotingRound(VotingRound const& other);
+	VotingRound(VotingRound&& other) noexcept = default;
+	auto operator=(VotingRound const& other) -> VotingRound&;
+	auto operator=(VotingRound&& other) noexcept -> VotingRound& = default;
+
+	// Adaptive rounds finish once every item's rating deviation is at most the given one
+	static auto create(Items const& items, VotingFormat voting_format, Seed seed = 0, double adaptive_rating_deviation = kDefaultAdaptiveRatingDeviation) -> std::optional<VotingRound>;
 	static auto create(std::vector<std::string> const& lines) -> std::optional<VotingRound>;
+	static auto create(MappedFile const& file) -> std::optional<VotingRound>;
+	static auto createFromBinary(std::string_view const data) -> std::optional<VotingRound>;
+	// Loads a voting round file. Votes and undos left in its journal, by a program which ended
+	// without saving or discarding them, are replayed on top and appended to the file.
+	static auto load(std::string const& file_name) -> std::optional<VotingRound>;
 
 	auto shuffle() -> bool;
 
 	auto vote(Option option) -> bool;
 	auto undoVote() -> bool;
 	auto save(std::string const& file_name) -> bool;
+	void setEncoding(VotingRoundEncoding const encoding) noexcept;
+
+	// Saves the voting round once, then journals each following vote and undo next to the file.
+	// Saving to the same file again only appends the journaled records to it. Stopping the journal
+	// discards the records since the last save. Fails without saving if records left in an earlier
+	// journal of the file haven't been recovered by loading it.
+	// Only applicable to VotingRoundEncoding::Text, other encodings are saved as usual.
+	auto startJournal(std::string const& file_name, uint32_t const sync_interval) -> bool;
+	void stopJournal();
+	auto isJournaling() const noexcept -> bool;
 
 	// Internal members access
-	auto items() const noexcept -> Items const&;
+	auto items() const -> ItemsView;
 	auto originalItemOrder() const noexcept -> Items const&;
 	auto format() const noexcept -> VotingFormat;
 	auto seed() const noexcept -> Seed;
-	auto votes() const noexcept -> Votes const&;
+	auto pairOrder() const noexcept -> PairOrder;
+	auto adaptiveRatingDeviation() const noexcept -> double;
+	auto votes() const noexcept -> VoteLog const&;
 	auto isSaved() const noexcept -> bool;
+	auto encoding() const noexcept -> VotingRoundEncoding;
+
+	// Scores of the items voted on so far, from the running tally of wins and losses, with
+	// Bradley-Terry strengths fitted to the votes
+	auto scores() const -> Scores;
 
 	// TODO: This is an implementation detail currently, only applicable for
 	// VotingFormat::Ranking. Find a better way to deal with this.
@@ -86,8 +199,12 @@ public:
 	auto currentVotingLine() const -> std::optional<std::string>;
 	auto hasRemainingVotes() const -> bool;
 	auto convertToText() const -> std::vector<std::string>;
+	auto convertToBinary() const -> std::string;
 
 private:
+	static auto createFromLines(Lines const& lines) -> std::optional<VotingRound>;
+	auto finishLoading() -> bool;
+
 	auto shuffleImpl() -> bool;
 	auto counterStringImpl() const -> std::string;
 	auto voteImpl(Option option) -> bool;
@@ -97,14 +214,26 @@ private:
 	auto hasRemainingVotesImpl() const noexcept -> bool;
 	auto numberOfSortedItemsImpl() const noexcept -> uint32_t;
 	auto numberOfScheduledVotesImpl() const noexcept -> uint32_t;
+	auto item(Index const position) const noexcept -> Item const&;
+	void addToTally(Vote const& vote);
+	void removeFromTally(Vote const& vote);
 
 	std::optional<ScoreBased> score_based_{};
 	std::optional<RankBased> rank_based_{};
+	std::optional<MergeInsertion> merge_insertion_{};
+	std::optional<AdaptiveRanking> adaptive_ranking_{};
 
 	Items original_items_order_{};
-	Items items_{};
+	ItemOrder item_order_{};
 	Seed seed_{ 0 };
-	Votes votes_{};
+	PairOrder pair_order_{ PairOrder::Shuffled };
+	double adaptive_rating_deviation_{ kDefaultAdaptiveRatingDeviation };
+	// Stored column-wise, so loading counts wins and losses reading only the indices and winner bits
+	VoteLog votes_{};
+	std::vector<uint32_t> wins_{};
+	std::vector<uint32_t> losses_{};
 	bool is_saved_{ false };
 	VotingFormat voting_format_{ VotingFormat::Invalid };
+	VotingRoundEncoding encoding_{ VotingRoundEncoding::Text };
+	std::unique_ptr<VoteJournal> journal_{};
 };